@@ -93,6 +93,11 @@ protected:
   checkSizeCompatibility(const API::MatrixWorkspace_const_sptr lhs,
                          const API::MatrixWorkspace_const_sptr rhs) const;
 
+  /// Whether performEventBinaryOperation(EventList&, const EventList&) keeps
+  /// the cached histograms of the lhs up to date, so that an in-place
+  /// operation need not clear them
+  virtual bool updatesCachedHistograms() const { return false; }
+
   virtual bool propagateSpectraMask(const API::SpectrumInfo &lhsSpectrumInfo,
                                     const API::SpectrumInfo &rhsSpectrumInfo,
                                     const int64_t index,
@@ -217,6 +222,8 @@ protected:
   bool m_AllowDifferentNumberSpectra{false};
   /// Flag to clear RHS workspace in binary operation
   bool m_ClearRHSWorkspace{false};
+  /// Flag to add the rhs events to the cached histograms of the output
+  bool m_updateCachedHistograms{false};
   /// Cache for LHS workspace's blocksize
   size_t m_lhsBlocksize;
   /// Cache for RHS workspace's blocksize
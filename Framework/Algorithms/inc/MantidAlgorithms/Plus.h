@@ -65,6 +65,7 @@ private:
                                    const double &rhsE) override;
 
   void checkRequirements() override;
+  bool updatesCachedHistograms() const override { return true; }
   std::string checkSizeCompatibility(
       const API::MatrixWorkspace_const_sptr lhs,
       const API::MatrixWorkspace_const_sptr rhs) const override;
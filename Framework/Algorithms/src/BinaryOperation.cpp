@@ -201,6 +201,7 @@ void BinaryOperation::exec() {
     throw std::invalid_argument(ostr.str());
   }
 
+  m_updateCachedHistograms = false;
   // Is the output going to be an EventWorkspace?
   if (m_keepEventWorkspace) {
     // The output WILL be EventWorkspace (this implies lhs is EW or rhs is EW +
@@ -227,11 +228,20 @@ void BinaryOperation::exec() {
       m_eout = std::dynamic_pointer_cast<EventWorkspace>(m_out);
     }
 
-    // Always clear the MRUs.
-    m_eout->clearMRU();
-    if (m_elhs)
-      m_elhs->clearMRU();
-    if (m_erhs)
+    // Clear the MRUs, unless the operation is done in-place by appending
+    // event lists and there are cached histograms of the output to update.
+    m_updateCachedHistograms = m_out == m_lhs && updatesCachedHistograms() &&
+                               !m_eout->MRUEmpty();
+    if (!m_updateCachedHistograms) {
+      m_eout->clearMRU();
+      if (m_elhs)
+        m_elhs->clearMRU();
+    } else if (m_erhs) {
+      // Histogramming the rhs event lists may sort them. Sort them now, as
+      // the same rhs list can be read by several threads at once.
+      m_erhs->sortAll(TOF_SORT, nullptr);
+    }
+    if (m_erhs && m_erhs != m_eout)
       m_erhs->clearMRU();
 
   } else {
@@ -56,6 +56,8 @@ void Minus::performEventBinaryOperation(DataObjects::EventList &lhs,
                                         const DataObjects::EventList &rhs) {
   // Easy, no? :) - This appends the event lists, with the rhs being negatively
   // weighted.
+  if (m_updateCachedHistograms && &lhs != &rhs)
+    lhs.addToCachedHistogram(rhs, true);
   lhs -= rhs;
 }
 
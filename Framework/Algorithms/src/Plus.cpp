@@ -59,6 +59,8 @@ void Plus::performBinaryOperation(const HistogramData::Histogram &lhs,
 void Plus::performEventBinaryOperation(DataObjects::EventList &lhs,
                                        const DataObjects::EventList &rhs) {
   // Easy, no? :) - This appends the event lists.
+  if (m_updateCachedHistograms)
+    lhs.addToCachedHistogram(rhs, false);
   lhs += rhs;
 }
 
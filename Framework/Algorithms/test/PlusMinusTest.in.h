@@ -480,6 +480,33 @@ public:
         DO_PLUS ? 4.0 : 0.0, 2.0);
   }
 
+  void test_Event_Event_inPlace_updates_cached_histograms()
+  {
+    int nHist = 5,nBins=10;
+    EventWorkspace_sptr work_in1 = WorkspaceCreationHelper::createEventWorkspace(nHist,nBins,50,0.0,1.0,2);
+    MatrixWorkspace_sptr work_in2 = WorkspaceCreationHelper::createEventWorkspace(nHist,nBins,50,0.0,1.0,2);
+    // Cache the histograms of the lhs before the operation
+    for (int i=0; i<nHist; i++)
+    {
+      work_in1->y(i);
+      work_in1->e(i);
+    }
+    const size_t cached = work_in1->MRUSize();
+    // The values checked are those of the updated cache
+    performTest(work_in1,work_in2, true, true /*outputIsEvent*/,
+        DO_PLUS ? 4.0 : 0.0, 2.0);
+    TS_ASSERT_EQUALS(work_in1->MRUSize(), cached);
+
+    const auto y = work_in1->y(0);
+    const auto e = work_in1->e(0);
+    work_in1->clearMRU();
+    for (int j=0; j<nBins; j++)
+    {
+      TS_ASSERT_DELTA(y[j], work_in1->y(0)[j], 1e-10);
+      TS_ASSERT_DELTA(e[j], work_in1->e(0)[j], 1e-10);
+    }
+  }
+
   void test_Event_EventSingleSpectrum_fails()
   {
     MatrixWorkspace_sptr work_in1 = eventWS_5x10_50;
@@ -9,16 +9,30 @@
 #include "MantidAPI/Axis.h"
 #include "MantidDataHandling/DllConfig.h"
 #include "MantidDataHandling/EventWorkspaceCollection.h"
+#include "MantidKernel/BoundedQueue.h"
+#include "MantidKernel/Task.h"
+
+#include <exception>
+#include <mutex>
 
 class BankPulseTimes;
 
 namespace Mantid {
 namespace DataHandling {
+class LoadBankFromDiskTask;
 class LoadEventNexus;
 
 /** Helper class for LoadEventNexus that is specific to the current default
   loading code for NXevent_data entries in Nexus files, in particular
   LoadBankFromDiskTask and ProcessBankData.
+
+  Loading runs as a pipeline of two stages joined by a bounded queue. A single
+  thread reads the banks from the file, largest first, as the NeXus API cannot
+  be used from several threads at once. It runs ahead of the other stage until
+  the queue is full. The remaining threads take the banks that have been read
+  from the queue, look up the workspace index of each event and append it to
+  the event list. The lookup is a single table access, so it is done in the
+  same pass as the append rather than being a stage of its own.
 */
 class MANTID_DATAHANDLING_DLL DefaultEventLoader {
 public:
@@ -27,7 +41,10 @@ public:
        bool event_id_is_spec, std::vector<std::string> bankNames,
        const std::vector<int> &periodLog, const std::string &classType,
        std::vector<std::size_t> bankNumEvents, const bool oldNeXusFileNames,
-       const bool precount, const int chunk, const int totalChunks);
+       const bool precount, const bool exactPrecount, const int chunk,
+       const int totalChunks);
+
+  bool queueProcessing(std::shared_ptr<Kernel::Task> task);
 
   /// Flag for dealing with a simulated file
   bool m_haveWeights;
@@ -38,7 +55,7 @@ public:
   /// whether or not to launch multiple ProcessBankData jobs per bank
   bool splitProcessing;
 
-  /// Do we pre-count the # of events in each pixel ID?
+  /// Do we pre-count the # of events in each pixel ID, one bank at a time?
   bool precount;
 
   /// Offset in the pixelID_to_wi_vector to use.
@@ -77,6 +94,13 @@ public:
   std::vector<std::shared_ptr<BankPulseTimes>> m_bankPulseTimes;
 
 private:
+  void presizeEventLists(
+      const std::vector<std::shared_ptr<LoadBankFromDiskTask>> &tasks);
+  void readBanks(std::vector<std::shared_ptr<LoadBankFromDiskTask>> tasks);
+  void processBanks(double &busySeconds, double &waitSeconds,
+                    size_t &numTasks);
+  void stopPipeline(std::exception_ptr error);
+
   DefaultEventLoader(LoadEventNexus *alg, EventWorkspaceCollection &ws,
                      bool haveWeights, bool event_id_is_spec,
                      const size_t numBanks, const bool precount,
@@ -87,6 +111,17 @@ private:
   /// Map detector IDs to event lists.
   template <class T>
   void makeMapToEventLists(std::vector<std::vector<T>> &vectors);
+
+  /// Number of threads processing banks that have been read
+  size_t m_numProcessingThreads;
+  /// Banks that have been read, waiting to be processed
+  Kernel::BoundedQueue<std::shared_ptr<Kernel::Task>> m_processQueue;
+  /// Time the reading stage spent waiting for space in the queue, in seconds
+  double m_queueWaitSeconds{0.};
+  /// The first error thrown by either stage
+  std::exception_ptr m_pipelineError;
+  /// Guards m_pipelineError
+  std::mutex m_pipelineErrorMutex;
 };
 
 /** Generate a look-up table where the index = the pixel ID of an event
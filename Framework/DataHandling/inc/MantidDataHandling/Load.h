@@ -84,9 +84,14 @@ private:
   getOutputWorkspace(const std::string &propName,
                      const API::IAlgorithm_sptr &loader) const;
 
-  /// Load a file to a given workspace name.
-  API::Workspace_sptr loadFileToWs(const std::string &fileName,
-                                   const std::string &wsName);
+  /// Create a child Load for a file, ready to be executed.
+  API::IAlgorithm_sptr createFileLoad(const std::string &fileName,
+                                      const std::string &wsName);
+  /// Load a row of files, concurrently where possible, and sum them.
+  API::Workspace_sptr loadAndSum(const std::vector<std::string> &fileNames,
+                                 const std::string &wsName);
+  /// The number of runs that may be loaded at once.
+  size_t concurrentLoadLimit(const size_t runSize, const size_t numRuns) const;
   /// Plus two workspaces together, "in place".
   API::Workspace_sptr plusWs(API::Workspace_sptr ws1,
                              const API::Workspace_sptr &ws2);
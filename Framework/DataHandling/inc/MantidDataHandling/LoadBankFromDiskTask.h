@@ -9,7 +9,6 @@
 #include "MantidAPI/Progress.h"
 #include "MantidDataHandling/DllConfig.h"
 #include "MantidKernel/Task.h"
-#include "MantidKernel/ThreadScheduler.h"
 
 #include <nexus/NeXusFile.hpp>
 
@@ -19,8 +18,9 @@ namespace Mantid {
 namespace DataHandling {
 class DefaultEventLoader;
 
-/** This task does the disk IO from loading the NXS file, and so will be on a
-  disk IO mutex
+/** This task does the disk IO from loading the NXS file. The tasks are run
+  one at a time by the reading stage of DefaultEventLoader, and each hands the
+  ProcessBankData tasks for its bank on to the processing stage.
 */
 class MANTID_DATAHANDLING_DLL LoadBankFromDiskTask : public Kernel::Task {
 
@@ -30,11 +30,10 @@ public:
                        const std::string &entry_type,
                        const std::size_t numEvents,
                        const bool oldNeXusFileNames, API::Progress *prog,
-                       std::shared_ptr<std::mutex> ioMutex,
-                       Kernel::ThreadScheduler &scheduler,
                        const std::vector<int> &framePeriodNumbers);
 
   void run() override;
+  void countEvents(std::vector<std::vector<std::size_t>> &counts);
 
 private:
   void loadPulseTimes(::NeXus::File &file);
@@ -43,6 +42,11 @@ private:
                       int64_t &stop_event,
                       const std::vector<uint64_t> &event_index);
   std::unique_ptr<std::vector<uint32_t>> loadEventId(::NeXus::File &file);
+  void countEventIds(::NeXus::File &file, const int64_t start_event,
+                     const int64_t stop_event,
+                     const std::vector<uint64_t> &event_index,
+                     std::vector<std::vector<std::size_t>> &counts);
+  bool limitIdRange();
   std::unique_ptr<std::vector<float>> loadTof(::NeXus::File &file);
   std::unique_ptr<std::vector<float>> loadEventWeights(::NeXus::File &file);
   int64_t recalculateDataSize(const int64_t &size);
@@ -55,8 +59,6 @@ private:
   std::string entry_type;
   /// Progress reporting
   API::Progress *prog;
-  /// ThreadScheduler running this task
-  Kernel::ThreadScheduler &scheduler;
   /// Object with the pulse times for this bank
   std::shared_ptr<BankPulseTimes> thisBankPulseTimes;
   /// Did we get an error in loading
@@ -105,6 +105,11 @@ public:
       std::unique_ptr<const Kernel::TimeSeriesProperty<int>> &periodLog,
       const int &nPeriods, const std::string &nexusfilename);
 
+  static Types::Core::DateAndTime
+  compressStartTimeFor(const Types::Core::DateAndTime &runStart,
+                       const Types::Core::DateAndTime &firstPulse,
+                       const double wallClockTolerance);
+
   template <typename T>
   static void loadEntryMetadata(const std::string &nexusfilename, T WS,
                                 const std::string &entry_name,
@@ -192,6 +197,11 @@ public:
 
   /// Tolerance for CompressEvents; use -1 to mean don't compress.
   double compressTolerance;
+  /// Wall-clock tolerance (in seconds) for CompressEvents; EMPTY_DBL() to
+  /// compress all pulse times together.
+  double compressWallClockTolerance;
+  /// Start of the wall-clock bins when compressing with a wall-clock tolerance
+  Types::Core::DateAndTime compressStartTime;
 
   /// Pulse times for ALL banks, taken from proton_charge log.
   std::shared_ptr<BankPulseTimes> m_allBanksPulseTimes;
@@ -9,6 +9,11 @@
 #include "MantidAPI/NexusFileLoader.h"
 #include <nexus/NeXusFile.hpp>
 
+#include <functional>
+#include <memory>
+#include <utility>
+#include <vector>
+
 namespace Mantid {
 namespace Kernel {
 class Property;
@@ -58,6 +63,9 @@ public:
     return 0;
   }
 
+  /// Creates the property of a log from the arrays read from the file
+  using LogBuilder = std::function<std::unique_ptr<Kernel::Property>()>;
+
 private:
   /// Overwrites Algorithm method.
   void init() override;
@@ -73,18 +81,36 @@ private:
    */
   void loadLogs(::NeXus::File &file, const std::string &absolute_entry_name,
                 const std::string &entry_class,
-                const std::shared_ptr<API::MatrixWorkspace> &workspace) const;
+                const std::shared_ptr<API::MatrixWorkspace> &workspace);
 
   /**
-   * Load an NXlog entry
+   * Read an NXlog entry, leaving the creation of its property for later
    * @param file input Nexus file handler
    * @param absolute_entry_name full entry name in Nexus
    * @param entry_class type of the entry (NXlog)
    * @param workspace input workspace
+   * @param logs the logs read, to which this one is added
    */
   void loadNXLog(::NeXus::File &file, const std::string &absolute_entry_name,
                  const std::string &entry_class,
-                 const std::shared_ptr<API::MatrixWorkspace> &workspace) const;
+                 const std::shared_ptr<API::MatrixWorkspace> &workspace,
+                 std::vector<std::pair<std::string, LogBuilder>> &logs) const;
+
+  /**
+   * Create the properties of the logs read, in parallel, and add them to the
+   * run in the order they were read
+   * @param logs the names of the logs read and the functions creating them
+   * @param workspace input workspace
+   */
+  void addLogs(std::vector<std::pair<std::string, LogBuilder>> &logs,
+               const std::shared_ptr<API::MatrixWorkspace> &workspace);
+
+  /**
+   * Whether a log is selected by the AllowList and BlockList properties
+   * @param name name of the log entry
+   * @return true if the log is to be loaded
+   */
+  bool isLogSelected(const std::string &name) const;
 
   /**
    * Load an IXseblock entry
@@ -107,6 +133,11 @@ private:
   /// Use frequency start for Monitor19 and Special1_19 logs with "No Time" for
   /// SNAP
   std::string freqStart;
+
+  /// Patterns of the names of the logs to load, or empty to load all
+  std::vector<std::string> m_allowList;
+  /// Patterns of the names of the logs not to load
+  std::vector<std::string> m_blockList;
 };
 
 } // namespace DataHandling
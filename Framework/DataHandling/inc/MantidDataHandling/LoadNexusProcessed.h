@@ -139,8 +139,7 @@ private:
                                            const double &progressRange);
   API::MatrixWorkspace_sptr
   loadNonEventEntry(Mantid::NeXus::NXData &wksp_cls,
-                    Mantid::NeXus::NXDouble &xbins, const double &progressStart,
-                    const double &progressRange,
+                    const double &progressStart, const double &progressRange,
                     const Mantid::NeXus::NXEntry &mtd_entry, const int xlength,
                     std::string &workspaceType);
 
@@ -162,30 +161,27 @@ private:
   void readBinMasking(Mantid::NeXus::NXData &wksp_cls,
                       const API::MatrixWorkspace_sptr &local_workspace);
 
-  /// Load a block of data into the workspace where it is assumed that the x
-  /// bins have already been cached
-  void loadBlock(Mantid::NeXus::NXDataSetTyped<double> &data,
-                 Mantid::NeXus::NXDataSetTyped<double> &errors,
-                 Mantid::NeXus::NXDataSetTyped<double> &farea, bool hasFArea,
-                 Mantid::NeXus::NXDouble &xErrors, bool hasXErrors,
-                 int blocksize, int nchannels, int &hist,
-                 const API::MatrixWorkspace_sptr &local_workspace);
-
-  /// Load a block of data into the workspace where it is assumed that the x
-  /// bins have already been cached
-  void loadBlock(Mantid::NeXus::NXDataSetTyped<double> &data,
-                 Mantid::NeXus::NXDataSetTyped<double> &errors,
-                 Mantid::NeXus::NXDataSetTyped<double> &farea, bool hasFArea,
-                 Mantid::NeXus::NXDouble &xErrors, bool hasXErrors,
-                 int blocksize, int nchannels, int &hist, int &wsIndex,
-                 const API::MatrixWorkspace_sptr &local_workspace);
-  /// Load a block of data into the workspace
-  void loadBlock(Mantid::NeXus::NXDataSetTyped<double> &data,
-                 Mantid::NeXus::NXDataSetTyped<double> &errors,
-                 Mantid::NeXus::NXDataSetTyped<double> &farea, bool hasFArea,
-                 Mantid::NeXus::NXDouble &xErrors, bool hasXErrors,
-                 Mantid::NeXus::NXDouble &xbins, int blocksize, int nchannels,
-                 int &hist, int &wsIndex,
+  /// The datasets of the spectra of a Workspace2D entry, holding a block of
+  /// consecutive spectra once read
+  struct SpectraBlock {
+    Mantid::NeXus::NXDouble data;
+    Mantid::NeXus::NXDouble errors;
+    Mantid::NeXus::NXDouble farea;
+    Mantid::NeXus::NXDouble xErrors;
+    Mantid::NeXus::NXDouble xbins;
+    /// The workspace index of the first spectrum of the block
+    int wsIndex;
+    /// The number of spectra in the block
+    int count;
+  };
+
+  /// Read a block of consecutive spectra from the file
+  void readBlock(SpectraBlock &block, const bool hasFArea,
+                 const bool hasXErrors, const int hist, const int wsIndex,
+                 const int count);
+  /// Copy a block of spectra into the workspace
+  void fillBlock(const SpectraBlock &block, const bool hasFArea,
+                 const bool hasXErrors, const int nchannels,
                  const API::MatrixWorkspace_sptr &local_workspace);
 
   /// Load the data from a non-spectra axis (Numeric/Text) into the workspace
@@ -12,11 +12,15 @@
 #include "MantidDataHandling/LoadRawHelper.h"
 #include "MantidDataObjects/Workspace2D.h"
 #include <climits>
+#include <memory>
 
 //----------------------------------------------------------------------
 // Forward declaration
 //----------------------------------------------------------------------
 class ISISRAW2;
+namespace Poco {
+class SharedMemory;
+}
 
 namespace Mantid {
 namespace DataHandling {
@@ -32,6 +36,8 @@ class DLLExport LoadRaw3 : public LoadRawHelper {
 public:
   /// Default constructor
   LoadRaw3();
+  /// Destructor
+  ~LoadRaw3() override;
   /// Algorithm's name for identification overriding a virtual method
   const std::string name() const override { return "LoadRaw"; }
   /// Summary of algorithms purpose
@@ -50,11 +56,28 @@ public:
   const std::string category() const override { return "DataHandling\\Raw"; }
 
 private:
+  /// A spectrum of the file and where it is to be loaded
+  struct SpectrumToLoad {
+    /// Index of the spectrum in the data of the file
+    int hist;
+    /// Spectrum number
+    specnum_t specNum;
+    /// Workspace to load it into
+    DataObjects::Workspace2D_sptr workspace;
+    /// Index in the workspace
+    int64_t wsIndex;
+  };
+
   /// Overwrites Algorithm method.
   void init() override;
   /// Overwrites Algorithm method
   void exec() override;
 
+  /// returns true if the given spectrum is to be loaded
+  bool isSpectrumSelected(specnum_t spectrumNum) const;
+  /// reads the given spectra into their workspaces
+  void loadSpectra(FILE *file, const std::vector<SpectrumToLoad> &spectra);
+
   /// returns true if the given spectrum is a monitor
   bool isMonitor(const std::vector<specnum_t> &monitorIndexes,
                  specnum_t spectrumNum);
@@ -80,8 +103,6 @@ private:
                         const DataObjects::Workspace2D_sptr &ws_sptr,
                         const DataObjects::Workspace2D_sptr &mws_sptr);
 
-  /// skip all spectra in a period
-  void skipPeriod(FILE *file, const int64_t &period);
   /// return true if loading a selection of periods
   bool isSelectedPeriods() const { return !m_periodList.empty(); }
   /// check if a period should be loaded
@@ -120,6 +141,8 @@ private:
   int64_t m_total_specs;
   /// A list of periods to read. Each value is between 1 and m_numberOfPeriods
   std::vector<int> m_periodList;
+  /// The file mapped into memory, if it could be mapped
+  std::unique_ptr<Poco::SharedMemory> m_mappedFile;
 };
 
 } // namespace DataHandling
@@ -78,10 +78,21 @@ private:
       std::vector<int> &indices,
       const Mantid::API::MatrixWorkspace_const_sptr &matrixWorkspace);
 
+  /// The fields of a block of consecutive events, empty if not written
+  struct EventBlock {
+    std::vector<double> tofs;
+    std::vector<float> weights;
+    std::vector<float> errorSquareds;
+    std::vector<int64_t> pulsetimes;
+  };
+
   template <class T>
-  static void appendEventListData(const std::vector<T> &events, size_t offset,
-                                  double *tofs, float *weights,
+  static void appendEventListData(const std::vector<T> &events,
+                                  const size_t first, const size_t last,
+                                  size_t offset, double *tofs, float *weights,
                                   float *errorSquareds, int64_t *pulsetimes);
+  void fillEventBlock(const std::vector<int64_t> &indices, const int64_t start,
+                      const int64_t count, EventBlock &block);
 
   void execEvent(Mantid::NeXus::NexusFileIO *nexusFile,
                  const bool uniformSpectra, const std::vector<int> &spec);
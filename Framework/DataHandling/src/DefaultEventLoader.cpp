@@ -9,7 +9,11 @@
 #include "MantidDataHandling/LoadBankFromDiskTask.h"
 #include "MantidDataHandling/LoadEventNexus.h"
 #include "MantidKernel/ThreadPool.h"
-#include "MantidKernel/ThreadSchedulerMutexes.h"
+#include "MantidKernel/Timer.h"
+
+#include <algorithm>
+#include <numeric>
+#include <thread>
 
 using namespace Mantid::Kernel;
 
@@ -23,32 +27,89 @@ void DefaultEventLoader::load(LoadEventNexus *alg, EventWorkspaceCollection &ws,
                               const std::string &classType,
                               std::vector<std::size_t> bankNumEvents,
                               const bool oldNeXusFileNames, const bool precount,
-                              const int chunk, const int totalChunks) {
+                              const bool exactPrecount, const int chunk,
+                              const int totalChunks) {
+  // Counting the events of every bank up front replaces the counting done by
+  // each ProcessBankData
   DefaultEventLoader loader(alg, ws, haveWeights, event_id_is_spec,
-                            bankNames.size(), precount, chunk, totalChunks);
+                            bankNames.size(), precount && !exactPrecount,
+                            chunk, totalChunks);
 
   auto bankRange = loader.setupChunking(bankNames, bankNumEvents);
 
-  // Make the thread pool
-  auto scheduler = new ThreadSchedulerMutexes;
-  ThreadPool pool(scheduler);
-  auto diskIOMutex = std::make_shared<std::mutex>();
-
   // set up progress bar for the rest of the (multi-threaded) process
   size_t numProg = bankNames.size() * (1 + 3); // 1 = disktask, 3 = proc task
   if (loader.splitProcessing)
     numProg += bankNames.size() * 3; // 3 = second proc task
+  if (exactPrecount)
+    numProg += bankNames.size(); // 1 = counting task
   auto prog = std::make_unique<API::Progress>(loader.alg, 0.3, 1.0, numProg);
 
+  std::vector<std::shared_ptr<LoadBankFromDiskTask>> readTasks;
   for (size_t i = bankRange.first; i < bankRange.second; i++) {
     if (bankNumEvents[i] > 0)
-      pool.schedule(std::make_shared<LoadBankFromDiskTask>(
+      readTasks.emplace_back(std::make_shared<LoadBankFromDiskTask>(
           loader, bankNames[i], classType, bankNumEvents[i], oldNeXusFileNames,
-          prog.get(), diskIOMutex, *scheduler, periodLog));
+          prog.get(), periodLog));
+  }
+  // Read the largest banks first so that the processing of the last, small,
+  // banks does not hold up the end of the load
+  std::stable_sort(readTasks.begin(), readTasks.end(),
+                   [](const std::shared_ptr<LoadBankFromDiskTask> &lhs,
+                      const std::shared_ptr<LoadBankFromDiskTask> &rhs) {
+                     return lhs->cost() > rhs->cost();
+                   });
+  const size_t numBanks = readTasks.size();
+  const double numEvents = std::accumulate(
+      readTasks.cbegin(), readTasks.cend(), 0.,
+      [](double total, const std::shared_ptr<LoadBankFromDiskTask> &task) {
+        return total + task->cost();
+      });
+
+  auto &log = loader.alg->getLogger();
+  if (exactPrecount) {
+    Timer countTimer;
+    loader.presizeEventLists(readTasks);
+    log.information() << "Counted the events of " << numBanks << " banks in "
+                      << countTimer.elapsed() << " s\n";
   }
-  // Start and end all threads
-  pool.joinAll();
-  diskIOMutex.reset();
+
+  // Start the processing stage, then read the banks on this thread
+  const size_t numThreads = loader.m_numProcessingThreads;
+  std::vector<double> busySeconds(numThreads, 0.);
+  std::vector<double> waitSeconds(numThreads, 0.);
+  std::vector<size_t> numTasks(numThreads, 0);
+  std::vector<std::thread> processors;
+  for (size_t i = 0; i < numThreads; ++i)
+    processors.emplace_back(&DefaultEventLoader::processBanks, &loader,
+                            std::ref(busySeconds[i]), std::ref(waitSeconds[i]),
+                            std::ref(numTasks[i]));
+  Timer timer;
+  loader.readBanks(std::move(readTasks));
+  const double readSeconds = timer.elapsed_no_reset();
+  for (auto &processor : processors)
+    processor.join();
+  const double totalSeconds = timer.elapsed();
+
+  if (loader.m_pipelineError)
+    std::rethrow_exception(loader.m_pipelineError);
+
+  log.information() << "Read " << numBanks << " banks (" << numEvents
+                    << " events) in " << readSeconds << " s, "
+                    << numEvents / std::max(readSeconds, 1e-9)
+                    << " events/s, waiting " << loader.m_queueWaitSeconds
+                    << " s for the processing stage\n";
+  log.information() << "Processed "
+                    << std::accumulate(numTasks.cbegin(), numTasks.cend(),
+                                       size_t{0})
+                    << " tasks on " << numThreads << " threads in "
+                    << totalSeconds << " s, busy for "
+                    << std::accumulate(busySeconds.cbegin(),
+                                       busySeconds.cend(), 0.)
+                    << " s and waiting "
+                    << std::accumulate(waitSeconds.cbegin(),
+                                       waitSeconds.cend(), 0.)
+                    << " s for banks to be read\n";
 }
 
 DefaultEventLoader::DefaultEventLoader(LoadEventNexus *alg,
@@ -59,7 +120,10 @@ DefaultEventLoader::DefaultEventLoader(LoadEventNexus *alg,
                                        const int totalChunks)
     : m_haveWeights(haveWeights), event_id_is_spec(event_id_is_spec),
       precount(precount), chunk(chunk), totalChunks(totalChunks), alg(alg),
-      m_ws(ws) {
+      m_ws(ws),
+      m_numProcessingThreads(std::max<size_t>(
+          ThreadPool::getNumPhysicalCores(), 2) - 1),
+      m_processQueue(2 * m_numProcessingThreads) {
   // This map will be used to find the workspace index
   if (event_id_is_spec)
     pixelID_to_wi_vector =
@@ -84,6 +148,105 @@ DefaultEventLoader::DefaultEventLoader(LoadEventNexus *alg,
   splitProcessing = bool(numBanks * 2 < ThreadPool::getNumPhysicalCores());
 }
 
+/** Hand a task processing a bank that has been read on to the processing
+ * stage, waiting if the stage is too far behind.
+ * @param task :: the task to queue
+ * @return false if loading has failed and the task was dropped
+ */
+bool DefaultEventLoader::queueProcessing(std::shared_ptr<Task> task) {
+  Timer timer;
+  const bool queued = m_processQueue.push(std::move(task));
+  m_queueWaitSeconds += timer.elapsed();
+  return queued;
+}
+
+/** Count the events that will be loaded into each spectrum from every bank,
+ * then allocate each event list once at its final size. The processing stage
+ * then appends to event lists that never need to grow, and so are never
+ * copied.
+ * @param tasks :: the LoadBankFromDiskTask for each bank
+ */
+void DefaultEventLoader::presizeEventLists(
+    const std::vector<std::shared_ptr<LoadBankFromDiskTask>> &tasks) {
+  std::vector<std::vector<size_t>> counts(
+      m_ws.nPeriods(), std::vector<size_t>(m_ws.getNumberHistograms(), 0));
+  for (const auto &task : tasks) {
+    if (alg->getCancel())
+      return;
+    task->countEvents(counts);
+  }
+  for (size_t period = 0; period < counts.size(); ++period) {
+    for (size_t wi = 0; wi < counts[period].size(); ++wi) {
+      if (counts[period][wi] > 0)
+        m_ws.getSpectrum(wi, period).reserve(counts[period][wi]);
+    }
+  }
+}
+
+/** The reading stage: run the tasks reading each bank in turn, then tell the
+ * processing stage that there are no more banks to come.
+ * @param tasks :: the LoadBankFromDiskTask for each bank, in reading order
+ */
+void DefaultEventLoader::readBanks(
+    std::vector<std::shared_ptr<LoadBankFromDiskTask>> tasks) {
+  for (auto &task : tasks) {
+    if (m_processQueue.closed())
+      break; // the processing stage has failed
+    try {
+      task->run();
+    } catch (...) {
+      stopPipeline(std::current_exception());
+    }
+    // Release the task as soon as it is done with
+    task.reset();
+  }
+  m_processQueue.close();
+}
+
+/** The processing stage, run on each processing thread: run the tasks
+ * queued by the reading stage until it has finished.
+ * @param busySeconds :: returns the time spent running tasks
+ * @param waitSeconds :: returns the time spent waiting for banks to be read
+ * @param numTasks :: returns the number of tasks run
+ */
+void DefaultEventLoader::processBanks(double &busySeconds, double &waitSeconds,
+                                      size_t &numTasks) {
+  Timer timer;
+  std::shared_ptr<Task> task;
+  while (m_processQueue.pop(task)) {
+    waitSeconds += timer.elapsed();
+    bool failed;
+    {
+      std::lock_guard<std::mutex> lock(m_pipelineErrorMutex);
+      failed = bool(m_pipelineError);
+    }
+    // Skip what is left in the queue once either stage has failed
+    if (!failed) {
+      try {
+        task->run();
+      } catch (...) {
+        stopPipeline(std::current_exception());
+      }
+      ++numTasks;
+    }
+    task.reset();
+    busySeconds += timer.elapsed();
+  }
+  waitSeconds += timer.elapsed();
+}
+
+/** Record the first error thrown by a stage and stop the reading stage
+ * @param error :: the exception thrown
+ */
+void DefaultEventLoader::stopPipeline(std::exception_ptr error) {
+  {
+    std::lock_guard<std::mutex> lock(m_pipelineErrorMutex);
+    if (!m_pipelineError)
+      m_pipelineError = std::move(error);
+  }
+  m_processQueue.close();
+}
+
 std::pair<size_t, size_t>
 DefaultEventLoader::setupChunking(std::vector<std::string> &bankNames,
                                   std::vector<std::size_t> &bankNumEvents) {
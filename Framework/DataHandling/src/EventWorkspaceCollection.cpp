@@ -14,6 +14,7 @@
 #include "MantidIndexing/IndexInfo.h"
 #include "MantidKernel/UnitFactory.h"
 
+#include <algorithm>
 #include <memory>
 #include <set>
 #include <unordered_set>
@@ -114,9 +115,22 @@ void EventWorkspaceCollection::setNPeriods(
   }
 }
 
+/**
+ * Make room for more events in the event list at a workspace index, in every
+ * period, so that they can be added without reallocating. The capacity is at
+ * least doubled when it has to grow, so that reserving for many small chunks
+ * of events does not reallocate the list for each of them.
+ * @param wi :: workspace index of the event list
+ * @param size :: number of events that will be added, on top of those already
+ * in the list
+ */
 void EventWorkspaceCollection::reserveEventListAt(size_t wi, size_t size) {
   for (auto &ws : m_WsVec) {
-    ws->getSpectrum(wi).reserve(size);
+    auto &eventList = ws->getSpectrum(wi);
+    const size_t needed = eventList.getNumberEvents() + size;
+    const size_t capacity = eventList.capacity();
+    if (needed > capacity)
+      eventList.reserve(std::max(needed, 2 * capacity));
   }
 }
 
@@ -6,6 +6,7 @@
 // SPDX - License - Identifier: GPL - 3.0 +
 #include "MantidDataHandling/Load.h"
 #include "MantidAPI/AlgorithmManager.h"
+#include "MantidAPI/Axis.h"
 #include "MantidAPI/FileProperty.h"
 #include "MantidAPI/FrameworkManager.h"
 #include "MantidAPI/IEventWorkspace.h"
@@ -14,16 +15,28 @@
 #include "MantidAPI/IWorkspaceProperty.h"
 #include "MantidAPI/MultipleFileProperty.h"
 #include "MantidAPI/NexusFileLoader.h"
+#include "MantidAPI/Run.h"
+#include "MantidAPI/SpectrumInfo.h"
 #include "MantidAPI/WorkspaceGroup.h"
+#include "MantidDataObjects/EventWorkspace.h"
+#include "MantidGeometry/Instrument.h"
 #include "MantidKernel/ArrayProperty.h"
+#include "MantidKernel/BoundedValidator.h"
 #include "MantidKernel/FacilityInfo.h"
+#include "MantidKernel/Memory.h"
+#include "MantidKernel/MultiThreaded.h"
+#include "MantidKernel/NexusDescriptor.h"
+#include "MantidKernel/Unit.h"
 
 #include <Poco/Path.h>
 
 #include <algorithm>
 #include <cctype>
 #include <cstdio>
+#include <deque>
 #include <functional>
+#include <future>
+#include <mutex>
 #include <numeric>
 #include <set>
 
@@ -86,6 +99,75 @@ flattenVecOfVec(std::vector<std::vector<std::string>> vecOfVec) {
 
   return flattenedVec;
 }
+
+/// Serialises the loads of HDF files, which our HDF5 library cannot share
+/// between threads
+std::mutex g_hdfMutex;
+
+/**
+ * Check that Plus would add two event workspaces by appending the events of
+ * each spectrum of one to the same spectrum of the other, with nothing else to
+ * do but merge the runs: the workspaces are of the same instrument, have the
+ * same spectra and units, and have no masking to propagate.
+ *
+ * @param lhs :: the workspace summed into.
+ * @param rhs :: the workspace added.
+ *
+ * @returns true if the events can be appended without Plus
+ */
+bool canAppendEvents(const Mantid::DataObjects::EventWorkspace &lhs,
+                     const Mantid::DataObjects::EventWorkspace &rhs) {
+  const size_t numHist = lhs.getNumberHistograms();
+  if (rhs.getNumberHistograms() != numHist ||
+      lhs.getInstrument()->getName() != rhs.getInstrument()->getName() ||
+      lhs.getAxis(0)->unit()->unitID() != rhs.getAxis(0)->unit()->unitID() ||
+      lhs.YUnit() != rhs.YUnit() ||
+      lhs.isDistribution() != rhs.isDistribution())
+    return false;
+
+  const auto &lhsSpectrumInfo = lhs.spectrumInfo();
+  const auto &rhsSpectrumInfo = rhs.spectrumInfo();
+  for (size_t i = 0; i < numHist; ++i) {
+    if (lhs.getSpectrum(i).getSpectrumNo() !=
+            rhs.getSpectrum(i).getSpectrumNo() ||
+        (lhsSpectrumInfo.hasDetectors(i) && lhsSpectrumInfo.isMasked(i)) ||
+        (rhsSpectrumInfo.hasDetectors(i) && rhsSpectrumInfo.isMasked(i)) ||
+        rhs.hasMaskedBins(i))
+      return false;
+  }
+  return true;
+}
+
+/**
+ * Add the events of one run to another in place: each event list is appended
+ * to the list of the same spectrum and the runs are merged as Plus does. This
+ * avoids the copies of Plus, which an event workspace loaded from the same
+ * instrument does not need.
+ *
+ * @param lhs :: the workspace summed into.
+ * @param rhs :: the workspace added.
+ *
+ * @returns false if the workspaces are not event workspaces that pass the
+ * checks of canAppendEvents, in which case neither is changed
+ */
+bool appendEvents(const Mantid::API::Workspace_sptr &lhs,
+                  const Mantid::API::Workspace_sptr &rhs) {
+  using Mantid::DataObjects::EventWorkspace;
+  auto lhsEvents = std::dynamic_pointer_cast<EventWorkspace>(lhs);
+  auto rhsEvents = std::dynamic_pointer_cast<const EventWorkspace>(rhs);
+  if (!lhsEvents || !rhsEvents || lhsEvents == rhsEvents ||
+      !canAppendEvents(*lhsEvents, *rhsEvents))
+    return false;
+
+  const auto numHist = static_cast<int64_t>(lhsEvents->getNumberHistograms());
+  PARALLEL_FOR_IF(Mantid::Kernel::threadSafe(*lhsEvents, *rhsEvents))
+  for (int64_t i = 0; i < numHist; ++i) {
+    lhsEvents->getSpectrum(i) += rhsEvents->getSpectrum(i);
+  }
+  lhsEvents->clearMRU();
+  lhsEvents->mutableRun() += rhsEvents->run();
+  return true;
+}
 } // namespace
 
 namespace Mantid {
@@ -329,6 +411,12 @@ void Load::init() {
                   "will load the given file, its version "
                   "is set here.",
                   Direction::Output);
+  auto mustBeNonNegative = std::make_shared<BoundedValidator<int>>();
+  mustBeNonNegative->setLower(0);
+  declareProperty("MaxConcurrentLoads", 0, mustBeNonNegative,
+                  "When summing runs, the most runs to load at once. The "
+                  "default of 0 uses one per core. Fewer are loaded if the "
+                  "runs would not fit into half of the available memory.");
   // Save for later what the base Load properties are
   const std::vector<Property *> &props = this->getProperties();
   for (size_t i = 0; i < this->propertyCount(); ++i) {
@@ -410,19 +498,11 @@ void Load::loadMultipleFiles() {
   std::vector<API::Workspace_sptr> loadedWsList;
   loadedWsList.reserve(allFilenames.size());
 
-  Workspace_sptr tempWs;
-
   // Cycle through the filenames and wsNames.
   for (auto filenames = allFilenames.cbegin(); filenames != allFilenames.cend();
        ++filenames, ++wsName) {
-    auto filename = filenames->cbegin();
-    Workspace_sptr sumWS = loadFileToWs(*filename, *wsName);
-
-    ++filename;
-    for (; filename != filenames->cend(); ++filename) {
-      tempWs = loadFileToWs(*filename, "__@loadsum_temp@");
-      sumWS = plusWs(sumWS, tempWs);
-    }
+    Workspace_sptr sumWS = loadAndSum(*filenames, *wsName);
+    AnalysisDataService::Instance().addOrReplace(*wsName, sumWS);
 
     API::WorkspaceGroup_sptr group =
         std::dynamic_pointer_cast<WorkspaceGroup>(sumWS);
@@ -480,16 +560,6 @@ void Load::loadMultipleFiles() {
       setProperty(outWsPropName, childWs);
     }
   }
-
-  // Clean up.
-  if (tempWs) {
-    Algorithm_sptr alg =
-        AlgorithmManager::Instance().createUnmanaged("DeleteWorkspace");
-    alg->initialize();
-    alg->setChild(true);
-    alg->setProperty("Workspace", tempWs);
-    alg->execute();
-  }
 }
 
 /**
@@ -641,21 +711,24 @@ Load::getOutputWorkspace(const std::string &propName,
  * Overrides the default cancel() method. Calls cancel() on the actual loader.
  */
 void Load::cancel() {
+  // Passes the request on to any runs being loaded concurrently
+  Algorithm::cancel();
   if (m_loader) {
     m_loader->cancel();
   }
 }
 
 /**
- * Loads a file into a *hidden* workspace.
+ * Create a child Load for one of the files to be summed. The algorithm is
+ * created here, on the calling thread, but may be executed on another.
  *
  * @param fileName :: file name to load.
- * @param wsName   :: workspace name, which will be prefixed by a "__"
+ * @param wsName   :: name of the output workspace of the child.
  *
- * @returns a pointer to the loaded workspace
+ * @returns the child algorithm, ready to be executed
  */
-API::Workspace_sptr Load::loadFileToWs(const std::string &fileName,
-                                       const std::string &wsName) {
+API::IAlgorithm_sptr Load::createFileLoad(const std::string &fileName,
+                                          const std::string &wsName) {
   Mantid::API::IAlgorithm_sptr loadAlg = createChildAlgorithm("Load", 1);
 
   // Get the list properties for the concrete loader load algorithm
@@ -675,13 +748,90 @@ API::Workspace_sptr Load::loadFileToWs(const std::string &fileName,
       }
     }
   }
+  return loadAlg;
+}
 
-  loadAlg->executeAsChildAlg();
+/**
+ * Load a row of files and sum them in file order. The first run is loaded on
+ * its own to measure the memory a run needs; the rest are loaded concurrently,
+ * with at most concurrentLoadLimit() runs loaded but not yet summed. Our HDF5
+ * library cannot be used from several threads, so the loads of HDF files are
+ * run one at a time, but still overlap with the summing of earlier runs.
+ *
+ * @param fileNames :: the files to sum.
+ * @param wsName    :: name given to the outputs of the child loads.
+ *
+ * @returns the sum of the runs, which is the workspace of the first file
+ */
+API::Workspace_sptr Load::loadAndSum(const std::vector<std::string> &fileNames,
+                                     const std::string &wsName) {
+  // Property values are set here, as setting a Filename inspects the file
+  std::deque<IAlgorithm_sptr> loads;
+  for (const auto &fileName : fileNames)
+    loads.emplace_back(createFileLoad(fileName, wsName));
+
+  const bool serialLoads = std::any_of(
+      fileNames.cbegin(), fileNames.cend(), [](const auto &fileName) {
+        return NexusDescriptor::isReadable(fileName);
+      });
+  auto runLoad = [serialLoads](const IAlgorithm_sptr &load) {
+    std::unique_lock<std::mutex> lock(g_hdfMutex, std::defer_lock);
+    if (serialLoads)
+      lock.lock();
+    load->executeAsChildAlg();
+    Workspace_sptr ws = load->getProperty("OutputWorkspace");
+    return ws;
+  };
+
+  Workspace_sptr sumWS = runLoad(loads.front());
+  loads.pop_front();
+  if (loads.empty())
+    return sumWS;
+
+  const size_t limit =
+      concurrentLoadLimit(sumWS->getMemorySize(), loads.size());
+  g_log.information() << "Summing " << fileNames.size() << " runs with up to "
+                      << limit << " loaded concurrently.\n";
+  std::deque<std::future<Workspace_sptr>> pending;
+  auto startLoads = [&]() {
+    while (!loads.empty() && pending.size() < limit) {
+      pending.emplace_back(
+          std::async(std::launch::async, runLoad, loads.front()));
+      loads.pop_front();
+    }
+  };
 
-  Workspace_sptr ws = loadAlg->getProperty("OutputWorkspace");
-  // ws->setName(wsName);
-  AnalysisDataService::Instance().addOrReplace(wsName, ws);
-  return ws;
+  startLoads();
+  while (!pending.empty()) {
+    Workspace_sptr runWS = pending.front().get();
+    pending.pop_front();
+    startLoads();
+    interruption_point();
+    sumWS = plusWs(sumWS, runWS);
+  }
+  return sumWS;
+}
+
+/**
+ * Work out how many runs may be loaded at once. Each run is held in memory
+ * until it has been summed, so the runs in flight must fit into half of the
+ * memory available now.
+ *
+ * @param runSize :: the memory, in bytes, used by a loaded run.
+ * @param numRuns :: the number of runs still to load.
+ *
+ * @returns the number of runs to load concurrently, at least 1
+ */
+size_t Load::concurrentLoadLimit(const size_t runSize,
+                                 const size_t numRuns) const {
+  const int maxLoads = getProperty("MaxConcurrentLoads");
+  size_t limit = maxLoads > 0 ? static_cast<size_t>(maxLoads)
+                              : static_cast<size_t>(PARALLEL_GET_MAX_THREADS);
+  if (runSize > 0) {
+    const size_t budget = MemoryStats().availMem() * 1024 / 2;
+    limit = std::min(limit, budget / runSize);
+  }
+  return std::max(std::min(limit, numRuns), size_t(1));
 }
 
 /**
@@ -699,22 +849,17 @@ API::Workspace_sptr Load::plusWs(Workspace_sptr ws1,
 
   if (group1 && group2) {
     // If we're dealing with groups, then the child workspaces must be added
-    // separately - setProperty
-    // wont work otherwise.
-    std::vector<std::string> group1ChildWsNames = group1->getNames();
-    std::vector<std::string> group2ChildWsNames = group2->getNames();
-
-    if (group1ChildWsNames.size() != group2ChildWsNames.size())
+    // separately - setProperty wont work otherwise. The children are taken by
+    // index as runs loaded outside the ADS have no names.
+    if (group1->size() != group2->size())
       throw std::runtime_error("Unable to add group workspaces with different "
                                "number of child workspaces.");
 
-    auto group1ChildWsName = group1ChildWsNames.begin();
-    auto group2ChildWsName = group2ChildWsNames.begin();
-
-    for (; group1ChildWsName != group1ChildWsNames.end();
-         ++group1ChildWsName, ++group2ChildWsName) {
-      Workspace_sptr group1ChildWs = group1->getItem(*group1ChildWsName);
-      Workspace_sptr group2ChildWs = group2->getItem(*group2ChildWsName);
+    for (size_t i = 0; i < group1->size(); ++i) {
+      Workspace_sptr group1ChildWs = group1->getItem(i);
+      Workspace_sptr group2ChildWs = group2->getItem(i);
+      if (appendEvents(group1ChildWs, group2ChildWs))
+        continue;
 
       Mantid::API::IAlgorithm_sptr plusAlg = createChildAlgorithm("Plus", 1);
       plusAlg->setProperty<Workspace_sptr>("LHSWorkspace", group1ChildWs);
@@ -723,6 +868,9 @@ API::Workspace_sptr Load::plusWs(Workspace_sptr ws1,
       plusAlg->executeAsChildAlg();
     }
   } else if (!group1 && !group2) {
+    if (appendEvents(ws1, ws2))
+      return ws1;
+
     Mantid::API::IAlgorithm_sptr plusAlg = createChildAlgorithm("Plus", 1);
     plusAlg->setProperty<Workspace_sptr>("LHSWorkspace", ws1);
     plusAlg->setProperty<Workspace_sptr>("RHSWorkspace", ws2);
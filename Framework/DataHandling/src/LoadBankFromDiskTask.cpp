@@ -25,21 +25,16 @@ namespace DataHandling {
  * @param numEvents :: The number of events in the bank.
  * @param oldNeXusFileNames :: Identify if file is of old variety.
  * @param prog :: an optional Progress object
- * @param ioMutex :: a mutex shared for all Disk I-O tasks
- * @param scheduler :: the ThreadScheduler that runs this task.
  * @param framePeriodNumbers :: Period numbers corresponding to each frame
  */
 LoadBankFromDiskTask::LoadBankFromDiskTask(
     DefaultEventLoader &loader, const std::string &entry_name,
     const std::string &entry_type, const std::size_t numEvents,
     const bool oldNeXusFileNames, API::Progress *prog,
-    std::shared_ptr<std::mutex> ioMutex, Kernel::ThreadScheduler &scheduler,
     const std::vector<int> &framePeriodNumbers)
     : m_loader(loader), entry_name(entry_name), entry_type(entry_type),
-      prog(prog), scheduler(scheduler), m_loadError(false),
-      m_oldNexusFileNames(oldNeXusFileNames), m_have_weight(false),
-      m_framePeriodNumbers(framePeriodNumbers) {
-  setMutex(ioMutex);
+      prog(prog), m_loadError(false), m_oldNexusFileNames(oldNeXusFileNames),
+      m_have_weight(false), m_framePeriodNumbers(framePeriodNumbers) {
   m_cost = static_cast<double>(numEvents);
   m_min_id = std::numeric_limits<uint32_t>::max();
   m_max_id = 0;
@@ -244,6 +239,64 @@ LoadBankFromDiskTask::loadEventId(::NeXus::File &file) {
   return event_id;
 }
 
+/** Count the events in the event_id field, which has been opened, by the
+ * spectrum and period they will be loaded into. The field is read in blocks so
+ * that the whole of it is never held in memory.
+ * @param file :: An NeXus::File object opened at the event_id field
+ * @param start_event :: the index of the first event to count
+ * @param stop_event :: the index of the last event to count + 1
+ * @param event_index :: the index of the first event of each pulse
+ * @param counts :: the counts for each period and workspace index, which are
+ * added to
+ */
+void LoadBankFromDiskTask::countEventIds(
+    ::NeXus::File &file, const int64_t start_event, const int64_t stop_event,
+    const std::vector<uint64_t> &event_index,
+    std::vector<std::vector<std::size_t>> &counts) {
+  constexpr int64_t blockSize = 1 << 22;
+  const auto &pixelToWi = m_loader.pixelID_to_wi_vector;
+  const auto offset = static_cast<int64_t>(m_loader.pixelID_to_wi_offset);
+  // Only the IDs that run() would hand on to be processed are counted
+  int64_t minId = 0;
+  int64_t maxId = m_loader.eventid_max;
+  if (m_loader.alg->m_specMin != EMPTY_INT())
+    minId = std::max<int64_t>(minId, m_loader.alg->m_specMin);
+  if (m_loader.alg->m_specMax != EMPTY_INT())
+    maxId = std::min<int64_t>(maxId, m_loader.alg->m_specMax);
+
+  const bool multiPeriod = counts.size() > 1;
+  const auto numPulses =
+      std::min(event_index.size(), thisBankPulseTimes->numPulses);
+  size_t pulse = 0;
+  std::vector<uint32_t> ids;
+  for (int64_t blockStart = start_event; blockStart < stop_event;
+       blockStart += blockSize) {
+    if (m_loader.alg->getCancel())
+      return;
+    std::vector<int64_t> start{blockStart};
+    std::vector<int64_t> size{std::min(blockSize, stop_event - blockStart)};
+    ids.resize(static_cast<size_t>(size[0]));
+    file.getSlab(ids.data(), start, size);
+    for (size_t i = 0; i < ids.size(); ++i) {
+      const int64_t id = ids[i];
+      if (id < minId || id > maxId || id + offset < 0 ||
+          id + offset >= static_cast<int64_t>(pixelToWi.size()))
+        continue;
+      size_t period = 0;
+      if (multiPeriod && numPulses > 0) {
+        const auto event = static_cast<uint64_t>(blockStart) + i;
+        while (pulse + 1 < numPulses && event_index[pulse + 1] <= event)
+          ++pulse;
+        period =
+            static_cast<size_t>(thisBankPulseTimes->periodNumbers[pulse] - 1);
+      }
+      const auto wi = pixelToWi[id + offset];
+      if (period < counts.size() && wi < counts[period].size())
+        ++counts[period][wi];
+    }
+  }
+}
+
 /** Open and load the times-of-flight data
  * @param file An NeXus::File object opened at the correct group
  * @returns A new array containing the time of flights for this bank
@@ -350,6 +403,8 @@ void LoadBankFromDiskTask::run() {
   std::unique_ptr<std::vector<float>> event_time_of_flight;
   std::unique_ptr<std::vector<float>> event_weight;
   std::vector<uint64_t> event_index;
+  // Range of pixel IDs in the bank, before limiting it to the spectra loaded
+  uint32_t bank_size = 0;
 
   // Open the file
   ::NeXus::File file(m_loader.alg->m_filename);
@@ -392,6 +447,15 @@ void LoadBankFromDiskTask::run() {
           m_loadError = true; // To allow cancelling the algorithm
         }
 
+        // Don't read the rest of a bank with no pixels in the spectra loaded
+        bank_size = m_max_id - m_min_id;
+        if (!m_loadError && !this->limitIdRange()) {
+          m_loader.alg->getLogger().debug()
+              << "Bank " << entry_name
+              << " has no pixels in the range of spectra to load.\n";
+          m_loadError = true;
+        }
+
         // And TOF.
         if (!m_loadError) {
           event_time_of_flight = this->loadTof(file);
@@ -400,7 +464,14 @@ void LoadBankFromDiskTask::run() {
           }
         }
       } // Size is at least 1
-      else {
+      else if (m_loadSize[0] == 0 && m_loadStart[0] >= 0) {
+        // Nothing to read in the time window
+        m_loader.alg->getLogger().debug()
+            << "Bank " << entry_name << " has no events to load between "
+            << m_loader.alg->filter_time_start << " and "
+            << m_loader.alg->filter_time_stop << ".\n";
+        m_loadError = true;
+      } else {
         // Found a size that was 0 or less; stop processing
         m_loader.alg->getLogger().error()
             << "Loading bank " << entry_name
@@ -433,34 +504,6 @@ void LoadBankFromDiskTask::run() {
     return;
   }
 
-  const auto bank_size = m_max_id - m_min_id;
-  const auto minSpectraToLoad = static_cast<uint32_t>(m_loader.alg->m_specMin);
-  const auto maxSpectraToLoad = static_cast<uint32_t>(m_loader.alg->m_specMax);
-  const auto emptyInt = static_cast<uint32_t>(EMPTY_INT());
-  // check that if a range of spectra were requested that these fit within
-  // this bank
-  if (minSpectraToLoad != emptyInt && m_min_id < minSpectraToLoad) {
-    if (minSpectraToLoad > m_max_id) { // the minimum spectra to load is more
-                                       // than the max of this bank
-      return;
-    }
-    // the min spectra to load is higher than the min for this bank
-    m_min_id = minSpectraToLoad;
-  }
-  if (maxSpectraToLoad != emptyInt && m_max_id > maxSpectraToLoad) {
-    if (maxSpectraToLoad < m_min_id) {
-      // the maximum spectra to load is less than the minimum of this bank
-      return;
-    }
-    // the max spectra to load is lower than the max for this bank
-    m_max_id = maxSpectraToLoad;
-  }
-  if (m_min_id > m_max_id) {
-    // the min is now larger than the max, this means the entire block of
-    // spectra to load is outside this bank
-    return;
-  }
-
   // schedule the job to generate the event lists
   auto mid_id = m_max_id;
   if (m_loader.splitProcessing && m_max_id > (m_min_id + (bank_size / 4)))
@@ -468,7 +511,7 @@ void LoadBankFromDiskTask::run() {
     // of the whole bank
     mid_id = (m_max_id + m_min_id) / 2;
 
-  // No error? Launch a new task to process that data.
+  // No error? Hand the data on to be processed.
   auto numEvents = static_cast<size_t>(m_loadSize[0]);
   auto startAt = static_cast<size_t>(m_loadStart[0]);
 
@@ -484,14 +527,97 @@ void LoadBankFromDiskTask::run() {
       m_loader, entry_name, prog, event_id_shrd, event_time_of_flight_shrd,
       numEvents, startAt, event_index_shrd, thisBankPulseTimes, m_have_weight,
       event_weight_shrd, m_min_id, mid_id);
-  scheduler.push(newTask1);
+  if (!m_loader.queueProcessing(newTask1))
+    return;
   if (m_loader.splitProcessing && (mid_id < m_max_id)) {
     std::shared_ptr<Task> newTask2 = std::make_shared<ProcessBankData>(
         m_loader, entry_name, prog, event_id_shrd, event_time_of_flight_shrd,
         numEvents, startAt, event_index_shrd, thisBankPulseTimes, m_have_weight,
         event_weight_shrd, (mid_id + 1), m_max_id);
-    scheduler.push(newTask2);
+    m_loader.queueProcessing(newTask2);
+  }
+}
+
+/** Count the events of this bank that will be loaded into each spectrum, so
+ * that the event lists can be allocated before any of them are filled. Only
+ * the event_id field is read, and the events counted are those that run()
+ * loads, except for any removed by the time-of-flight filter.
+ * Errors are left for run() to report.
+ * @param counts :: the counts for each period and workspace index, which are
+ * added to
+ */
+void LoadBankFromDiskTask::countEvents(
+    std::vector<std::vector<std::size_t>> &counts) {
+  m_loadError = false;
+  prog->report(entry_name + ": count events");
+  try {
+    ::NeXus::File file(m_loader.alg->m_filename);
+    file.openGroup(m_loader.alg->m_top_entry_name, "NXentry");
+    file.openGroup(entry_name, entry_type);
+    const auto event_index = this->loadEventIndex(file);
+    if (!m_loadError) {
+      this->loadPulseTimes(file);
+      int64_t start_event = 0;
+      int64_t stop_event = 0;
+      this->prepareEventId(file, start_event, stop_event, event_index);
+      if (file.getInfo().type == ::NeXus::UINT32)
+        this->countEventIds(file, start_event, stop_event, event_index,
+                            counts);
+      file.closeData();
+    }
+  } catch (std::exception &e) {
+    m_loader.alg->getLogger().debug()
+        << "Could not count the events of bank " << entry_name << ": "
+        << e.what() << '\n';
+  }
+  m_loadError = false;
+}
+
+/** Limit the range of pixel IDs to process to the range of spectra to load,
+ * if one was given.
+ * @return false if none of the pixel IDs of the bank are in the range, or
+ * none of them map to a spectrum in the workspace
+ */
+bool LoadBankFromDiskTask::limitIdRange() {
+  const auto minSpectraToLoad = static_cast<uint32_t>(m_loader.alg->m_specMin);
+  const auto maxSpectraToLoad = static_cast<uint32_t>(m_loader.alg->m_specMax);
+  const auto emptyInt = static_cast<uint32_t>(EMPTY_INT());
+  // check that if a range of spectra were requested that these fit within
+  // this bank
+  if (minSpectraToLoad != emptyInt && m_min_id < minSpectraToLoad) {
+    if (minSpectraToLoad > m_max_id) { // the minimum spectra to load is more
+                                       // than the max of this bank
+      return false;
+    }
+    // the min spectra to load is higher than the min for this bank
+    m_min_id = minSpectraToLoad;
+  }
+  if (maxSpectraToLoad != emptyInt && m_max_id > maxSpectraToLoad) {
+    if (maxSpectraToLoad < m_min_id) {
+      // the maximum spectra to load is less than the minimum of this bank
+      return false;
+    }
+    // the max spectra to load is lower than the max for this bank
+    m_max_id = maxSpectraToLoad;
+  }
+  // if the min is now larger than the max, the entire block of spectra to
+  // load is outside this bank
+  if (m_min_id > m_max_id)
+    return false;
+  // check that at least one of the IDs in the range of this bank maps to a
+  // spectrum that is being loaded, e.g. one picked with SpectrumList
+  const auto &pixelToWi = m_loader.pixelID_to_wi_vector;
+  const auto numSpectra = m_loader.m_ws.getNumberHistograms();
+  const auto offset = static_cast<int64_t>(m_loader.pixelID_to_wi_offset);
+  const auto first = std::max(static_cast<int64_t>(m_min_id) + offset,
+                              static_cast<int64_t>(0));
+  const auto last = std::min(static_cast<int64_t>(m_max_id) + offset,
+                             static_cast<int64_t>(pixelToWi.size()) - 1);
+  for (auto index = first; index <= last; ++index) {
+    if (pixelToWi[index] < numSpectra)
+      return true;
   }
+  return false;
 }
 
 /**
@@ -78,7 +78,8 @@ bool exists(const std::map<std::string, std::string> &entries,
 LoadEventNexus::LoadEventNexus()
     : filter_tof_min(0), filter_tof_max(0), m_specMin(0), m_specMax(0),
       longest_tof(0), shortest_tof(0), bad_tofs(0), discarded_events(0),
-      compressTolerance(0), m_instrument_loaded_correctly(false),
+      compressTolerance(0), compressWallClockTolerance(EMPTY_DBL()),
+      m_instrument_loaded_correctly(false),
       loadlogs(false), event_id_is_spec(false) {}
 
 //----------------------------------------------------------------------------------------------
@@ -184,6 +185,16 @@ void LoadEventNexus::init() {
       "This can significantly reduce memory use and memory fragmentation; it "
       "may also speed up loading.");
 
+  declareProperty(
+      std::make_unique<PropertyWithValue<bool>>("ExactPrecount", false,
+                                                Direction::Input),
+      "Count the events in each spectrum from all of the banks in a separate "
+      "pass over the event IDs, before any events are loaded (optional, "
+      "default False). Each event list is then allocated once at its final "
+      "size, which uses the least memory and avoids copying events as the "
+      "lists grow, at the cost of reading the event IDs twice. Takes the "
+      "place of Precount.");
+
   declareProperty(std::make_unique<PropertyWithValue<double>>(
                       "CompressTolerance", -1.0, Direction::Input),
                   "Run CompressEvents while loading (optional, leave blank or "
@@ -191,6 +202,19 @@ void LoadEventNexus::init() {
                   "This specified the tolerance to use (in microseconds) when "
                   "compressing.");
 
+  auto wallClockMustBePositive = std::make_shared<BoundedValidator<double>>();
+  wallClockMustBePositive->setLower(0.0);
+  wallClockMustBePositive->setLowerExclusive(true);
+  declareProperty(std::make_unique<PropertyWithValue<double>>(
+                      "CompressWallClockTolerance", EMPTY_DBL(),
+                      wallClockMustBePositive, Direction::Input),
+                  "The tolerance (in seconds) on the wall-clock time when "
+                  "compressing while loading, measured from the start of the "
+                  "run. The compressed events keep a pulse time, so that they "
+                  "can still be filtered by time. Unset means compressing all "
+                  "wall-clock times together. Ignored unless "
+                  "CompressTolerance is set.");
+
   auto mustBePositive = std::make_shared<BoundedValidator<int>>();
   mustBePositive->setLower(1);
   declareProperty("ChunkNumber", EMPTY_INT(), mustBePositive,
@@ -207,7 +231,9 @@ void LoadEventNexus::init() {
 
   std::string grp3 = "Reduce Memory Use";
   setPropertyGroup("Precount", grp3);
+  setPropertyGroup("ExactPrecount", grp3);
   setPropertyGroup("CompressTolerance", grp3);
+  setPropertyGroup("CompressWallClockTolerance", grp3);
   setPropertyGroup("ChunkNumber", grp3);
   setPropertyGroup("TotalChunks", grp3);
 
@@ -384,6 +410,7 @@ void LoadEventNexus::execLoader() {
   m_filename = getPropertyValue("Filename");
 
   compressTolerance = getProperty("CompressTolerance");
+  compressWallClockTolerance = getProperty("CompressWallClockTolerance");
 
   loadlogs = getProperty("LoadLogs");
 
@@ -548,6 +575,30 @@ std::size_t numEvents(::NeXus::File &file, bool &hasTotalCounts,
   return numEvents;
 }
 
+/** The start of the wall-clock bins used to compress the events of a bank
+ * while loading. The bins start with the run, but are extended back by whole
+ * bins when the first pulse of the bank is earlier, so that no events are
+ * dropped and every bank uses the same bin boundaries.
+ *
+ * @param runStart :: the start of the run
+ * @param firstPulse :: the earliest pulse time of the bank
+ * @param wallClockTolerance :: the width of the wall-clock bins, in seconds
+ * @return the start of the first wall-clock bin
+ */
+DateAndTime LoadEventNexus::compressStartTimeFor(
+    const DateAndTime &runStart, const DateAndTime &firstPulse,
+    const double wallClockTolerance) {
+  if (firstPulse >= runStart)
+    return runStart;
+  const auto binWidth = static_cast<int64_t>(wallClockTolerance * 1.e9);
+  if (binWidth <= 0)
+    return firstPulse;
+  const int64_t before =
+      runStart.totalNanoseconds() - firstPulse.totalNanoseconds();
+  const int64_t numBins = (before + binWidth - 1) / binWidth;
+  return DateAndTime(runStart.totalNanoseconds() - numBins * binWidth);
+}
+
 /** Load the instrument from the nexus file
  *
  * @param nexusfilename :: The name of the nexus file being loaded
@@ -884,6 +935,9 @@ void LoadEventNexus::loadEvents(API::Progress *const prog,
 
   if (takeTimesFromEvents)
     run_start = firstPulseT;
+  // Wall-clock bins for compressing while loading start with the run. Each
+  // bank extends them back to its first pulse, see compressStartTimeFor.
+  compressStartTime = run_start;
 
   loadSampleDataISIScompatibility(*m_file, *m_ws);
 
@@ -1055,12 +1109,13 @@ void LoadEventNexus::loadEvents(API::Progress *const prog,
   }
   if (!loaded) {
     bool precount = getProperty("Precount");
+    bool exactPrecount = getProperty("ExactPrecount");
     int chunk = getProperty("ChunkNumber");
     int totalChunks = getProperty("TotalChunks");
     DefaultEventLoader::load(this, *m_ws, haveWeights, event_id_is_spec,
                              bankNames, periodLog->valuesAsVector(), classType,
-                             bankNumEvents, oldNeXusFileNames, precount, chunk,
-                             totalChunks);
+                             bankNumEvents, oldNeXusFileNames, precount,
+                             exactPrecount, chunk, totalChunks);
   }
 
   // Info reporting
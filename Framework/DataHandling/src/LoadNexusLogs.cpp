@@ -8,6 +8,7 @@
 #include "MantidAPI/FileProperty.h"
 #include "MantidAPI/Run.h"
 #include "MantidKernel/ArrayProperty.h"
+#include "MantidKernel/MultiThreaded.h"
 #include "MantidKernel/TimeSeriesProperty.h"
 #include <locale>
 #include <nexus/NeXusException.hpp>
@@ -15,6 +16,7 @@
 #include <Poco/DateTimeFormat.h>
 #include <Poco/DateTimeFormatter.h>
 #include <Poco/DateTimeParser.h>
+#include <Poco/Glob.h>
 #include <Poco/Path.h>
 
 #include "MantidDataHandling/LoadTOFRawNexus.h"
@@ -132,21 +134,22 @@ bool isControlValue(const char &c, const std::string &propName,
 }
 
 /**
- * Creates a time series property from the currently opened log entry. It is
- * assumed to
+ * Reads a time series from the currently opened log entry. It is assumed to
  * have been checked to have a time field and the value entry's name is given
- * as an argument
+ * as an argument. Only the reading is done here, the conversion of the arrays
+ * read into a property is left to the function returned so that it can be done
+ * on another thread.
  * @param file :: A reference to the file handle
  * @param propName :: The name of the property
  * @param freqStart :: A string containing the start time of the frequency log
  * on SNAP
  * @param log :: Reference to logger to print out to
- * @returns A pointer to a new property containing the time series
+ * @returns A function creating a new property containing the time series
  */
-std::unique_ptr<Kernel::Property> createTimeSeries(::NeXus::File &file,
-                                                   const std::string &propName,
-                                                   const std::string &freqStart,
-                                                   Kernel::Logger &log) {
+LoadNexusLogs::LogBuilder readTimeSeries(::NeXus::File &file,
+                                         const std::string &propName,
+                                         const std::string &freqStart,
+                                         Kernel::Logger &log) {
   file.openData("time");
   //----- Start time is an ISO8601 string date and time. ------
   std::string start;
@@ -223,12 +226,15 @@ std::unique_ptr<Kernel::Property> createTimeSeries(::NeXus::File &file,
       file.closeData();
       throw;
     }
-    // Make an int TSP
-    auto tsp = std::make_unique<TimeSeriesProperty<int>>(propName);
-    tsp->create(start_time, time_double, values);
-    tsp->setUnits(value_units);
     log.debug() << "   done reading \"value\" array\n";
-    return tsp;
+    // Make an int TSP
+    return [propName, start_time, time_double = std::move(time_double),
+            values = std::move(values), value_units]() {
+      auto tsp = std::make_unique<TimeSeriesProperty<int>>(propName);
+      tsp->create(start_time, time_double, values);
+      tsp->setUnits(value_units);
+      return std::unique_ptr<Kernel::Property>(std::move(tsp));
+    };
   } else if (info.type == ::NeXus::CHAR) {
     std::string values;
     const int64_t item_length = info.dims[1];
@@ -243,23 +249,25 @@ std::unique_ptr<Kernel::Property> createTimeSeries(::NeXus::File &file,
       file.closeData();
       throw;
     }
-    // The string may contain non-printable (i.e. control) characters, replace
-    // these
-    std::replace_if(
-        values.begin(), values.end(),
-        [&](const char &c) { return isControlValue(c, propName, log); }, ' ');
-    auto tsp = std::make_unique<TimeSeriesProperty<std::string>>(propName);
-    std::vector<DateAndTime> times;
-    DateAndTime::createVector(start_time, time_double, times);
-    const size_t ntimes = times.size();
-    for (size_t i = 0; i < ntimes; ++i) {
-      std::string value_i =
-          std::string(values.data() + i * item_length, item_length);
-      tsp->addValue(times[i], value_i);
-    }
-    tsp->setUnits(value_units);
     log.debug() << "   done reading \"value\" array\n";
-    return tsp;
+    return [propName, start_time, time_double = std::move(time_double),
+            values = std::move(values), item_length, value_units,
+            &log]() mutable {
+      // The string may contain non-printable (i.e. control) characters,
+      // replace these
+      std::replace_if(
+          values.begin(), values.end(),
+          [&](const char &c) { return isControlValue(c, propName, log); },
+          ' ');
+      std::vector<std::string> strings;
+      strings.reserve(time_double.size());
+      for (size_t i = 0; i < time_double.size(); ++i)
+        strings.emplace_back(values.data() + i * item_length, item_length);
+      auto tsp = std::make_unique<TimeSeriesProperty<std::string>>(propName);
+      tsp->create(start_time, time_double, strings);
+      tsp->setUnits(value_units);
+      return std::unique_ptr<Kernel::Property>(std::move(tsp));
+    };
   } else if (info.type == ::NeXus::FLOAT32 || info.type == ::NeXus::FLOAT64) {
     std::vector<double> values;
     try {
@@ -269,11 +277,14 @@ std::unique_ptr<Kernel::Property> createTimeSeries(::NeXus::File &file,
       file.closeData();
       throw;
     }
-    auto tsp = std::make_unique<TimeSeriesProperty<double>>(propName);
-    tsp->create(start_time, time_double, values);
-    tsp->setUnits(value_units);
     log.debug() << "   done reading \"value\" array\n";
-    return tsp;
+    return [propName, start_time, time_double = std::move(time_double),
+            values = std::move(values), value_units]() {
+      auto tsp = std::make_unique<TimeSeriesProperty<double>>(propName);
+      tsp->create(start_time, time_double, values);
+      tsp->setUnits(value_units);
+      return std::unique_ptr<Kernel::Property>(std::move(tsp));
+    };
   } else {
     throw ::NeXus::Exception(
         "Invalid value type for time series. Only int, double or strings are "
@@ -281,6 +292,23 @@ std::unique_ptr<Kernel::Property> createTimeSeries(::NeXus::File &file,
   }
 }
 
+/**
+ * Creates a time series property from the currently opened log entry, as
+ * described in readTimeSeries
+ * @param file :: A reference to the file handle
+ * @param propName :: The name of the property
+ * @param freqStart :: A string containing the start time of the frequency log
+ * on SNAP
+ * @param log :: Reference to logger to print out to
+ * @returns A pointer to a new property containing the time series
+ */
+std::unique_ptr<Kernel::Property> createTimeSeries(::NeXus::File &file,
+                                                   const std::string &propName,
+                                                   const std::string &freqStart,
+                                                   Kernel::Logger &log) {
+  return readTimeSeries(file, propName, freqStart, log)();
+}
+
 /**
  * Appends an additional entry to a TimeSeriesProperty which is at the end
  * time of the run and contains the last value of the property recorded before
@@ -357,6 +385,16 @@ void LoadNexusLogs::init() {
   declareProperty(std::make_unique<PropertyWithValue<std::string>>(
                       "NXentryName", "", Direction::Input),
                   "Entry in the nexus file from which to read the logs");
+  declareProperty(
+      std::make_unique<ArrayProperty<std::string>>("AllowList",
+                                                   Direction::Input),
+      "If set, only the time series logs whose names match one of these "
+      "patterns are loaded. The patterns may use the wildcards * and ?.");
+  declareProperty(
+      std::make_unique<ArrayProperty<std::string>>("BlockList",
+                                                   Direction::Input),
+      "The time series logs whose names match one of these patterns are not "
+      "loaded. The patterns may use the wildcards * and ?.");
 }
 
 /** Executes the algorithm. Reading in the file and creating and populating
@@ -370,6 +408,9 @@ void LoadNexusLogs::execLoader() {
   std::string filename = getPropertyValue("Filename");
   MatrixWorkspace_sptr workspace = getProperty("Workspace");
 
+  m_allowList = getProperty("AllowList");
+  m_blockList = getProperty("BlockList");
+
   std::string entry_name = getPropertyValue("NXentryName");
   // Find the entry name to use (normally "entry" for SNS, "raw_data_1" for
   // ISIS) if entry name is empty
@@ -678,11 +719,14 @@ void LoadNexusLogs::loadNPeriods(
 void LoadNexusLogs::loadLogs(
     ::NeXus::File &file, const std::string &absolute_entry_name,
     const std::string &entry_class,
-    const std::shared_ptr<API::MatrixWorkspace> &workspace) const {
+    const std::shared_ptr<API::MatrixWorkspace> &workspace) {
 
   const std::map<std::string, std::set<std::string>> &allEntries =
       getFileInfo()->getAllEntries();
 
+  // The NXlogs are read one at a time, as the file can only be read from one
+  // thread, and their properties created on several threads afterwards
+  std::vector<std::pair<std::string, LogBuilder>> nxLogs;
   auto lf_LoadByLogClass = [&](const std::string &logClass,
                                const bool isNxLog) {
     auto itLogClass = allEntries.find(logClass);
@@ -699,7 +743,7 @@ void LoadNexusLogs::loadLogs(
       // must be third level entry
       if (std::count(it->begin(), it->end(), '/') == 3) {
         if (isNxLog) {
-          loadNXLog(file, *it, logClass, workspace);
+          loadNXLog(file, *it, logClass, workspace, nxLogs);
         } else {
           loadSELog(file, *it, workspace);
         }
@@ -712,6 +756,8 @@ void LoadNexusLogs::loadLogs(
   file.openGroup(entry_name, entry_class);
   lf_LoadByLogClass("NXlog", true);
   lf_LoadByLogClass("NXpositioner", true);
+  // The names of the IXseblock logs depend on those already in the run
+  addLogs(nxLogs, workspace);
   lf_LoadByLogClass("IXseblock", false);
   loadVetoPulses(file, workspace);
 
@@ -729,10 +775,13 @@ void LoadNexusLogs::loadLogs(
 void LoadNexusLogs::loadNXLog(
     ::NeXus::File &file, const std::string &absolute_entry_name,
     const std::string &entry_class,
-    const std::shared_ptr<API::MatrixWorkspace> &workspace) const {
+    const std::shared_ptr<API::MatrixWorkspace> &workspace,
+    std::vector<std::pair<std::string, LogBuilder>> &logs) const {
 
   const std::string entry_name =
       absolute_entry_name.substr(absolute_entry_name.find_last_of("/") + 1);
+  if (!isLogSelected(entry_name))
+    return;
   g_log.debug() << "processing " << entry_name << ":" << entry_class << "\n";
   file.openGroup(entry_name, entry_class);
   // Validate the NX log class.
@@ -769,9 +818,8 @@ void LoadNexusLogs::loadNXLog(
   bool overwritelogs = this->getProperty("OverwriteLogs");
   try {
     if (overwritelogs || !(workspace->run().hasProperty(entry_name))) {
-      auto logValue = createTimeSeries(file, entry_name, freqStart, g_log);
-      appendEndTimeLog(logValue.get(), workspace->run());
-      workspace->mutableRun().addProperty(std::move(logValue), overwritelogs);
+      logs.emplace_back(entry_name,
+                        readTimeSeries(file, entry_name, freqStart, g_log));
     }
   } catch (::NeXus::Exception &e) {
     g_log.warning() << "NXlog entry " << entry_name
@@ -781,12 +829,49 @@ void LoadNexusLogs::loadNXLog(
   file.closeGroup();
 }
 
+void LoadNexusLogs::addLogs(
+    std::vector<std::pair<std::string, LogBuilder>> &logs,
+    const std::shared_ptr<API::MatrixWorkspace> &workspace) {
+  std::vector<std::unique_ptr<Kernel::Property>> properties(logs.size());
+  PARALLEL_FOR_NO_WSP_CHECK()
+  for (int i = 0; i < static_cast<int>(logs.size()); ++i) {
+    PARALLEL_START_INTERUPT_REGION
+    properties[i] = logs[i].second();
+    PARALLEL_END_INTERUPT_REGION
+  }
+  PARALLEL_CHECK_INTERUPT_REGION
+
+  // whether or not to overwrite logs on workspace
+  const bool overwritelogs = this->getProperty("OverwriteLogs");
+  auto &run = workspace->mutableRun();
+  for (size_t i = 0; i < logs.size(); ++i) {
+    // The same log may have been read from more than one group
+    if (overwritelogs || !run.hasProperty(logs[i].first)) {
+      appendEndTimeLog(properties[i].get(), run);
+      run.addProperty(std::move(properties[i]), overwritelogs);
+    }
+  }
+  logs.clear();
+}
+
+bool LoadNexusLogs::isLogSelected(const std::string &name) const {
+  const auto matches = [&name](const std::string &pattern) {
+    return Poco::Glob(pattern).match(name);
+  };
+  if (!m_allowList.empty() &&
+      std::none_of(m_allowList.cbegin(), m_allowList.cend(), matches))
+    return false;
+  return std::none_of(m_blockList.cbegin(), m_blockList.cend(), matches);
+}
+
 void LoadNexusLogs::loadSELog(
     ::NeXus::File &file, const std::string &absolute_entry_name,
     const std::shared_ptr<API::MatrixWorkspace> &workspace) const {
   // Open the entry
   const std::string entry_name =
       absolute_entry_name.substr(absolute_entry_name.find_last_of("/") + 1);
+  if (!isLogSelected(entry_name))
+    return;
 
   file.openGroup(entry_name, "IXseblock");
   std::string propName = entry_name;
@@ -38,6 +38,9 @@
 
 #include <nexus/NeXusException.hpp>
 
+#include <array>
+#include <functional>
+#include <future>
 #include <map>
 #include <memory>
 #include <string>
@@ -1248,20 +1251,18 @@ API::Workspace_sptr LoadNexusProcessed::loadPeaksEntry(NXEntry &entry) {
  * Load a Workspace2D
  *
  * @param wksp_cls Nexus data for "Workspace2D" (or "offsets_workspace")
- * @param xbins bins on the "X" axis
  * @param progressStart algorithm progress (from 0)
  * @param progressRange progress made after loading an entry
  * @param mtd_entry Nexus entry for "mantid_workspace_..."
- * @param xlength bins in the "X" axis (xbins)
+ * @param xlength bins in the "X" axis
  * @param workspaceType Takes values like "Workspace2D", "RebinnedOutput",
  *etc.
  *
  * @return workspace object containing loaded data
  */
 API::MatrixWorkspace_sptr LoadNexusProcessed::loadNonEventEntry(
-    NXData &wksp_cls, NXDouble &xbins, const double &progressStart,
-    const double &progressRange, const NXEntry &mtd_entry, const int xlength,
-    std::string &workspaceType) {
+    NXData &wksp_cls, const double &progressStart, const double &progressRange,
+    const NXEntry &mtd_entry, const int xlength, std::string &workspaceType) {
   // Filter the list of spectra to process, applying min/max/list options
   NXDataSetTyped<double> data = wksp_cls.openDoubleData();
   int nchannels = data.dim1();
@@ -1328,138 +1329,61 @@ API::MatrixWorkspace_sptr LoadNexusProcessed::loadNonEventEntry(
                          "last value will be dropped.\n";
   }
 
-  int blocksize = 8;
-  // const int fullblocks = nspectra / blocksize;
-  // size of the workspace
-  // have to cast down to int as later functions require ints
-  int fullblocks = static_cast<int>(total_specs) / blocksize;
-  int read_stop = (fullblocks * blocksize);
+  // The spectra to load, as runs of consecutive spectra in the file given by
+  // the first spectrum and the number of spectra
+  std::vector<std::pair<int, int>> runs;
+  if (m_interval || m_list) {
+    if (m_interval)
+      runs.emplace_back(m_spec_min - 1, m_spec_max - m_spec_min);
+    for (const auto spec : m_spec_list) {
+      if (!runs.empty() && runs.back().first + runs.back().second == spec - 1)
+        ++runs.back().second;
+      else
+        runs.emplace_back(spec - 1, 1);
+    }
+  } else {
+    runs.emplace_back(0, static_cast<int>(total_specs));
+  }
+
+  // The file can only be read from one thread, so the spectra are read in
+  // blocks of about a million values from each dataset. Each block is copied
+  // into the workspace on several threads while the next one is read.
+  const int blocksize = std::max(1, (1 << 20) / std::max(nchannels, 1));
+  const auto openBlock = [&]() {
+    return SpectraBlock{
+        wksp_cls.openDoubleData(), wksp_cls.openNXDouble("errors"),
+        wksp_cls.openNXDouble(hasFracArea ? "frac_area" : "errors"),
+        wksp_cls.openNXDouble(hasXErrors ? "xerrors" : "errors"),
+        wksp_cls.openNXDouble("axis1"), 0, 0};
+  };
+  std::array<SpectraBlock, 2> blocks{{openBlock(), openBlock()}};
+  std::future<void> filling;
   const double progressBegin = progressStart + 0.25 * progressRange;
   const double progressScaler = 0.75 * progressRange;
-  int hist_index = 0;
+  size_t current = 0;
   int wsIndex = 0;
-  if (m_shared_bins) {
-    // if spectrum min,max,list properties are set
-    if (m_interval || m_list) {
-      // if spectrum max,min properties are set read the data as a
-      // block(multiple of 8) and
-      // then read the remaining data as finalblock
-      if (m_interval) {
-        // specs at the min-max interval
-        int interval_specs = m_spec_max - m_spec_min;
-        fullblocks = (interval_specs) / blocksize;
-        read_stop = (fullblocks * blocksize) + m_spec_min - 1;
-
-        if (interval_specs < blocksize) {
-          blocksize = static_cast<int>(total_specs);
-          read_stop = m_spec_max - 1;
-        }
-        hist_index = m_spec_min - 1;
-
-        for (; hist_index < read_stop;) {
-          progress(progressBegin + progressScaler *
-                                       static_cast<double>(hist_index) /
-                                       static_cast<double>(read_stop),
-                   "Reading workspace data...");
-          loadBlock(data, errors, fracarea, hasFracArea, xErrors, hasXErrors,
-                    blocksize, nchannels, hist_index, wsIndex, local_workspace);
-        }
-        size_t finalblock = m_spec_max - 1 - read_stop;
-        if (finalblock > 0) {
-          loadBlock(data, errors, fracarea, hasFracArea, xErrors, hasXErrors,
-                    static_cast<int>(finalblock), nchannels, hist_index,
-                    wsIndex, local_workspace);
-        }
-      }
-      // if spectrum list property is set read each spectrum separately by
-      // setting blocksize=1
-      if (m_list) {
-        for (const auto itr : m_spec_list) {
-          int specIndex = itr - 1;
-          progress(progressBegin + progressScaler *
-                                       static_cast<double>(specIndex) /
-                                       static_cast<double>(m_spec_list.size()),
-                   "Reading workspace data...");
-          loadBlock(data, errors, fracarea, hasFracArea, xErrors, hasXErrors, 1,
-                    nchannels, specIndex, wsIndex, local_workspace);
-        }
-      }
-    } else {
-      for (; hist_index < read_stop;) {
-        progress(progressBegin + progressScaler *
-                                     static_cast<double>(hist_index) /
-                                     static_cast<double>(read_stop),
-                 "Reading workspace data...");
-        loadBlock(data, errors, fracarea, hasFracArea, xErrors, hasXErrors,
-                  blocksize, nchannels, hist_index, wsIndex, local_workspace);
-      }
-      size_t finalblock = total_specs - read_stop;
-      if (finalblock > 0) {
-        loadBlock(data, errors, fracarea, hasFracArea, xErrors, hasXErrors,
-                  static_cast<int>(finalblock), nchannels, hist_index, wsIndex,
-                  local_workspace);
-      }
-    }
-
-  } else {
-    if (m_interval || m_list) {
-      if (m_interval) {
-        int interval_specs = m_spec_max - m_spec_min;
-        fullblocks = (interval_specs) / blocksize;
-        read_stop = (fullblocks * blocksize) + m_spec_min - 1;
-
-        if (interval_specs < blocksize) {
-          blocksize = interval_specs;
-          read_stop = m_spec_max - 1;
-        }
-        hist_index = m_spec_min - 1;
-
-        for (; hist_index < read_stop;) {
-          progress(progressBegin + progressScaler *
-                                       static_cast<double>(hist_index) /
-                                       static_cast<double>(read_stop),
-                   "Reading workspace data...");
-          loadBlock(data, errors, fracarea, hasFracArea, xErrors, hasXErrors,
-                    xbins, blocksize, nchannels, hist_index, wsIndex,
-                    local_workspace);
-        }
-        size_t finalblock = m_spec_max - 1 - read_stop;
-        if (finalblock > 0) {
-          loadBlock(data, errors, fracarea, hasFracArea, xErrors, hasXErrors,
-                    xbins, static_cast<int>(finalblock), nchannels, hist_index,
-                    wsIndex, local_workspace);
-        }
-      }
-      //
-      if (m_list) {
-        for (const auto itr : m_spec_list) {
-          int specIndex = itr - 1;
-          progress(progressBegin + progressScaler *
-                                       static_cast<double>(specIndex) /
-                                       static_cast<double>(read_stop),
-                   "Reading workspace data...");
-          loadBlock(data, errors, fracarea, hasFracArea, xErrors, hasXErrors,
-                    xbins, 1, nchannels, specIndex, wsIndex, local_workspace);
-        }
-      }
-    } else {
-      for (; hist_index < read_stop;) {
-        progress(progressBegin + progressScaler *
-                                     static_cast<double>(hist_index) /
-                                     static_cast<double>(read_stop),
-                 "Reading workspace data...");
-        loadBlock(data, errors, fracarea, hasFracArea, xErrors, hasXErrors,
-                  xbins, blocksize, nchannels, hist_index, wsIndex,
-                  local_workspace);
-      }
-      size_t finalblock = total_specs - read_stop;
-      if (finalblock > 0) {
-        loadBlock(data, errors, fracarea, hasFracArea, xErrors, hasXErrors,
-                  xbins, static_cast<int>(finalblock), nchannels, hist_index,
-                  wsIndex, local_workspace);
-      }
+  for (const auto &run : runs) {
+    const int runEnd = run.first + run.second;
+    for (int hist = run.first; hist < runEnd; hist += blocksize) {
+      auto &block = blocks[current];
+      readBlock(block, hasFracArea, hasXErrors, hist, wsIndex,
+                std::min(blocksize, runEnd - hist));
+      // The other block must be in the workspace before this one is copied,
+      // so that any bins shared between them are found
+      if (filling.valid())
+        filling.get();
+      filling = std::async(std::launch::async, &LoadNexusProcessed::fillBlock,
+                           this, std::cref(block), hasFracArea, hasXErrors,
+                           nchannels, std::cref(local_workspace));
+      current = 1 - current;
+      wsIndex += block.count;
+      progress(progressBegin + progressScaler * static_cast<double>(wsIndex) /
+                                   static_cast<double>(total_specs),
+               "Reading workspace data...");
     }
   }
+  if (filling.valid())
+    filling.get();
   return local_workspace;
 }
 
@@ -1515,7 +1439,10 @@ API::Workspace_sptr LoadNexusProcessed::loadEntry(NXRoot &root,
   // "X" axis
 
   NXDouble xbins = wksp_cls.openNXDouble("axis1");
-  xbins.load();
+  // Non-uniform bins of a Workspace2D are read along with each block of
+  // spectra rather than all at once
+  if (isEvent)
+    xbins.load();
   std::string unit1 = xbins.attributes("units");
   // Non-uniform x bins get saved as a 2D 'axis1' dataset
   int xlength(-1);
@@ -1542,8 +1469,8 @@ API::Workspace_sptr LoadNexusProcessed::loadEntry(NXRoot &root,
         loadEventEntry(wksp_cls, xbins, progressStart, progressRange);
   } else {
     local_workspace =
-        loadNonEventEntry(wksp_cls, xbins, progressStart, progressRange,
-                          mtd_entry, xlength, workspaceType);
+        loadNonEventEntry(wksp_cls, progressStart, progressRange, mtd_entry,
+                          xlength, workspaceType);
   }
   size_t nspectra = local_workspace->getNumberHistograms();
 
@@ -1884,251 +1811,107 @@ void LoadNexusProcessed::readBinMasking(
 }
 
 /**
- * Perform a call to nxgetslab, via the NexusClasses wrapped methods for a
- * given
- * blocksize. This assumes that the
- * xbins have alread been cached
- * @param data :: The NXDataSet object of y values
- * @param errors :: The NXDataSet object of error values
- * @param farea :: The NXDataSet object of fraction area values
+ * Read a block of consecutive spectra from the file, via the NexusClasses
+ * wrapped calls to nxgetslab. The x bins are read too unless they are shared
+ * by every spectrum, in which case they have already been cached.
+ * @param block :: The datasets to read the spectra into
  * @param hasFArea :: Flag to signal a RebinnedOutput workspace is in use
- * @param xErrors :: The NXDataSet object of xError values
  * @param hasXErrors :: Flag to signal the File contains x errors
- * @param blocksize :: The blocksize to use
- * @param nchannels :: The number of channels for the block
- * @param hist :: The workspace index to start reading into
- * @param local_workspace :: A pointer to the workspace
+ * @param hist :: The first spectrum of the block in the file
+ * @param wsIndex :: The workspace index the first spectrum is loaded into
+ * @param count :: The number of spectra in the block
  */
-void LoadNexusProcessed::loadBlock(
-    NXDataSetTyped<double> &data, NXDataSetTyped<double> &errors,
-    NXDataSetTyped<double> &farea, bool hasFArea, NXDouble &xErrors,
-    bool hasXErrors, int blocksize, int nchannels, int &hist,
-    const API::MatrixWorkspace_sptr &local_workspace) {
-  data.load(blocksize, hist);
-  errors.load(blocksize, hist);
-  double *data_start = data();
-  double *data_end = data_start + nchannels;
-  double *err_start = errors();
-  double *err_end = err_start + nchannels;
-  double *farea_start = nullptr;
-  double *farea_end = nullptr;
-  double *xErrors_start = nullptr;
-  double *xErrors_end = nullptr;
-  size_t dx_increment = nchannels;
-  // NexusFileIO stores Dx data for all spectra (sharing not preserved) so dim0
-  // is the histograms, dim1 is Dx length. For old files this is nchannels+1,
-  // otherwise nchannels. See #16298.
-  // WARNING: We are dropping the last Dx value for old files!
-  size_t dx_input_increment = xErrors.dim1();
-  RebinnedOutput_sptr rb_workspace;
-  if (hasFArea) {
-    farea.load(blocksize, hist);
-    farea_start = farea();
-    farea_end = farea_start + nchannels;
-    rb_workspace = std::dynamic_pointer_cast<RebinnedOutput>(local_workspace);
-  }
-  if (hasXErrors) {
-    xErrors.load(blocksize, hist);
-    xErrors_start = xErrors();
-    xErrors_end = xErrors_start + dx_increment;
-  }
-
-  int final(hist + blocksize);
-  while (hist < final) {
-    auto &Y = local_workspace->mutableY(hist);
-    Y.assign(data_start, data_end);
-    data_start += nchannels;
-    data_end += nchannels;
-    auto &E = local_workspace->mutableE(hist);
-    E.assign(err_start, err_end);
-    err_start += nchannels;
-    err_end += nchannels;
-    if (hasFArea) {
-      MantidVec &F = rb_workspace->dataF(hist);
-      F.assign(farea_start, farea_end);
-      farea_start += nchannels;
-      farea_end += nchannels;
-    }
-    if (hasXErrors) {
-      local_workspace->setSharedDx(
-          hist, Kernel::make_cow<HistogramData::HistogramDx>(xErrors_start,
-                                                             xErrors_end));
-      xErrors_start += dx_input_increment;
-      xErrors_end += dx_input_increment;
-    }
-
-    local_workspace->setSharedX(hist, m_xbins.cowData());
-    ++hist;
-  }
+void LoadNexusProcessed::readBlock(SpectraBlock &block, const bool hasFArea,
+                                   const bool hasXErrors, const int hist,
+                                   const int wsIndex, const int count) {
+  block.data.load(count, hist);
+  block.errors.load(count, hist);
+  if (hasFArea)
+    block.farea.load(count, hist);
+  if (hasXErrors)
+    block.xErrors.load(count, hist);
+  if (!m_shared_bins)
+    block.xbins.load(count, hist);
+  block.wsIndex = wsIndex;
+  block.count = count;
 }
 
 /**
- * Perform a call to nxgetslab, via the NexusClasses wrapped methods for a
- * given
- * blocksize. This assumes that the
- * xbins have alread been cached
- * @param data :: The NXDataSet object of y values
- * @param errors :: The NXDataSet object of error values
- * @param farea :: The NXDataSet object of fraction area values
+ * Copy a block of spectra read by readBlock into the workspace, one spectrum
+ * per thread. Spectra with the same x bins as the one before share a single
+ * copy of them, so workspaces saved with shared but non-uniform bins keep
+ * sharing them once loaded. This assumes that the spectra before the block
+ * have already been copied.
+ * @param block :: The datasets holding the spectra
  * @param hasFArea :: Flag to signal a RebinnedOutput workspace is in use
- * @param xErrors :: The NXDataSet object of xError values
  * @param hasXErrors :: Flag to signal the File contains x errors
- * @param blocksize :: The blocksize to use
- * @param nchannels :: The number of channels for the block
- * @param hist :: The workspace index to start reading into
- * @param wsIndex :: The workspace index to save data into
+ * @param nchannels :: The number of channels of each spectrum
  * @param local_workspace :: A pointer to the workspace
  */
-
-void LoadNexusProcessed::loadBlock(
-    NXDataSetTyped<double> &data, NXDataSetTyped<double> &errors,
-    NXDataSetTyped<double> &farea, bool hasFArea, NXDouble &xErrors,
-    bool hasXErrors, int blocksize, int nchannels, int &hist, int &wsIndex,
-    const API::MatrixWorkspace_sptr &local_workspace) {
-  data.load(blocksize, hist);
-  errors.load(blocksize, hist);
-  double *data_start = data();
-  double *data_end = data_start + nchannels;
-  double *err_start = errors();
-  double *err_end = err_start + nchannels;
-  double *farea_start = nullptr;
-  double *farea_end = nullptr;
-  double *xErrors_start = nullptr;
-  double *xErrors_end = nullptr;
-  size_t dx_increment = nchannels;
+void LoadNexusProcessed::fillBlock(
+    const SpectraBlock &block, const bool hasFArea, const bool hasXErrors,
+    const int nchannels, const API::MatrixWorkspace_sptr &local_workspace) {
   // NexusFileIO stores Dx data for all spectra (sharing not preserved) so dim0
   // is the histograms, dim1 is Dx length. For old files this is nchannels+1,
   // otherwise nchannels. See #16298.
   // WARNING: We are dropping the last Dx value for old files!
-  size_t dx_input_increment = xErrors.dim1();
+  const int dx_input_increment = hasXErrors ? block.xErrors.dim1() : 0;
+  const int nxbins = m_shared_bins ? 0 : block.xbins.dim1();
   RebinnedOutput_sptr rb_workspace;
-  if (hasFArea) {
-    farea.load(blocksize, hist);
-    farea_start = farea();
-    farea_end = farea_start + nchannels;
+  if (hasFArea)
     rb_workspace = std::dynamic_pointer_cast<RebinnedOutput>(local_workspace);
-  }
-  if (hasXErrors) {
-    xErrors.load(blocksize, hist);
-    xErrors_start = xErrors();
-    xErrors_end = xErrors_start + dx_increment;
-  }
+  // Whether the bins of each spectrum are the same as those of the one before
+  std::vector<char> sameXAsPrevious(block.count, false);
 
-  int final(hist + blocksize);
-  while (hist < final) {
-    auto &Y = local_workspace->mutableY(wsIndex);
-    Y.assign(data_start, data_end);
-    data_start += nchannels;
-    data_end += nchannels;
-    auto &E = local_workspace->mutableE(wsIndex);
-    E.assign(err_start, err_end);
-    err_start += nchannels;
-    err_end += nchannels;
+  PARALLEL_FOR_NO_WSP_CHECK()
+  for (int i = 0; i < block.count; ++i) {
+    PARALLEL_START_INTERUPT_REGION
+    const int wsIndex = block.wsIndex + i;
+    const double *data_start = block.data() + i * nchannels;
+    local_workspace->mutableY(wsIndex).assign(data_start,
+                                              data_start + nchannels);
+    const double *err_start = block.errors() + i * nchannels;
+    local_workspace->mutableE(wsIndex).assign(err_start, err_start + nchannels);
     if (hasFArea) {
-      MantidVec &F = rb_workspace->dataF(wsIndex);
-      F.assign(farea_start, farea_end);
-      farea_start += nchannels;
-      farea_end += nchannels;
+      const double *farea_start = block.farea() + i * nchannels;
+      rb_workspace->dataF(wsIndex).assign(farea_start,
+                                          farea_start + nchannels);
     }
     if (hasXErrors) {
+      const double *xErrors_start = block.xErrors() + i * dx_input_increment;
       local_workspace->setSharedDx(
-          wsIndex, Kernel::make_cow<HistogramData::HistogramDx>(xErrors_start,
-                                                                xErrors_end));
-      xErrors_start += dx_input_increment;
-      xErrors_end += dx_input_increment;
+          wsIndex, Kernel::make_cow<HistogramData::HistogramDx>(
+                       xErrors_start, xErrors_start + nchannels));
     }
-    local_workspace->setSharedX(wsIndex, m_xbins.cowData());
-    ++hist;
-    ++wsIndex;
-  }
-}
-
-/**
- * Perform a call to nxgetslab, via the NexusClasses wrapped methods for a
- * given
- * blocksize. The xbins are read along with
- * each call to the data/error loading
- * @param data :: The NXDataSet object of y values
- * @param errors :: The NXDataSet object of error values
- * @param farea :: The NXDataSet object of fraction area values
- * @param hasFArea :: Flag to signal a RebinnedOutput workspace is in use
- * @param xErrors :: The NXDataSet object of xError values
- * @param hasXErrors :: Flag to signal the File contains x errors
- * @param xbins :: The xbin NXDataSet
- * @param blocksize :: The blocksize to use
- * @param nchannels :: The number of channels for the block
- * @param hist :: The workspace index to start reading into
- * @param wsIndex :: The workspace index to save data into
- * @param local_workspace :: A pointer to the workspace
- */
-void LoadNexusProcessed::loadBlock(
-    NXDataSetTyped<double> &data, NXDataSetTyped<double> &errors,
-    NXDataSetTyped<double> &farea, bool hasFArea, NXDouble &xErrors,
-    bool hasXErrors, NXDouble &xbins, int blocksize, int nchannels, int &hist,
-    int &wsIndex, const API::MatrixWorkspace_sptr &local_workspace) {
-  data.load(blocksize, hist);
-  double *data_start = data();
-  double *data_end = data_start + nchannels;
-  errors.load(blocksize, hist);
-  double *err_start = errors();
-  double *err_end = err_start + nchannels;
-  double *farea_start = nullptr;
-  double *farea_end = nullptr;
-  double *xErrors_start = nullptr;
-  double *xErrors_end = nullptr;
-  size_t dx_increment = nchannels;
-  // NexusFileIO stores Dx data for all spectra (sharing not preserved) so dim0
-  // is the histograms, dim1 is Dx length. For old files this is nchannels+1,
-  // otherwise nchannels. See #16298.
-  // WARNING: We are dropping the last Dx value for old files!
-  size_t dx_input_increment = xErrors.dim1();
-  RebinnedOutput_sptr rb_workspace;
-  if (hasFArea) {
-    farea.load(blocksize, hist);
-    farea_start = farea();
-    farea_end = farea_start + nchannels;
-    rb_workspace = std::dynamic_pointer_cast<RebinnedOutput>(local_workspace);
-  }
-  xbins.load(blocksize, hist);
-  const int nxbins(xbins.dim1());
-  double *xbin_start = xbins();
-  double *xbin_end = xbin_start + nxbins;
-  int final(hist + blocksize);
-
-  if (hasXErrors) {
-    xErrors.load(blocksize, hist);
-    xErrors_start = xErrors();
-    xErrors_end = xErrors_start + dx_increment;
+    if (m_shared_bins) {
+      local_workspace->setSharedX(wsIndex, m_xbins.cowData());
+    } else {
+      const double *xbin_start = block.xbins() + i * nxbins;
+      const double *xbin_end = xbin_start + nxbins;
+      if (i > 0) {
+        sameXAsPrevious[i] = std::equal(xbin_start, xbin_end,
+                                        xbin_start - nxbins, xbin_start);
+      } else if (wsIndex > 0) {
+        const auto &previousX = local_workspace->x(wsIndex - 1);
+        sameXAsPrevious[i] = std::equal(xbin_start, xbin_end,
+                                        previousX.cbegin(), previousX.cend());
+      }
+      if (!sameXAsPrevious[i])
+        local_workspace->setSharedX(
+            wsIndex,
+            Kernel::make_cow<HistogramData::HistogramX>(xbin_start, xbin_end));
+    }
+    PARALLEL_END_INTERUPT_REGION
   }
+  PARALLEL_CHECK_INTERUPT_REGION
 
-  while (hist < final) {
-    auto &Y = local_workspace->mutableY(wsIndex);
-    Y.assign(data_start, data_end);
-    data_start += nchannels;
-    data_end += nchannels;
-    auto &E = local_workspace->mutableE(wsIndex);
-    E.assign(err_start, err_end);
-    err_start += nchannels;
-    err_end += nchannels;
-    if (hasFArea) {
-      MantidVec &F = rb_workspace->dataF(wsIndex);
-      F.assign(farea_start, farea_end);
-      farea_start += nchannels;
-      farea_end += nchannels;
-    }
-    if (hasXErrors) {
-      local_workspace->setSharedDx(
-          wsIndex, Kernel::make_cow<HistogramData::HistogramDx>(xErrors_start,
-                                                                xErrors_end));
-      xErrors_start += dx_input_increment;
-      xErrors_end += dx_input_increment;
+  // In order, so that runs of spectra all share the bins of the first
+  for (int i = 0; i < block.count; ++i) {
+    if (sameXAsPrevious[i]) {
+      const int wsIndex = block.wsIndex + i;
+      local_workspace->setSharedX(wsIndex,
+                                  local_workspace->sharedX(wsIndex - 1));
     }
-    auto &X = local_workspace->mutableX(wsIndex);
-    X.assign(xbin_start, xbin_end);
-    xbin_start += nxbins;
-    xbin_end += nxbins;
-    ++hist;
-    ++wsIndex;
   }
 }
 
@@ -8,6 +8,8 @@
 #include "byte_rel_comp.h"
 #include <cstdio>
 #include <exception>
+#include <stdexcept>
+#include <string>
 
 #include "MantidKernel/ConfigService.h"
 #include "MantidKernel/Logger.h"
@@ -124,6 +126,11 @@ int ISISRAW2::ioRAW(FILE *file, bool from_file, bool read_data) {
     outbuff = new char[m_bufferSize];
   ndes = t_nper * (t_nsp1 + 1);
   ISISRAW::ioRAW(file, &ddes, ndes, true);
+  // The compressed spectra follow the descriptors one after the other
+  m_dataPositions.resize(ndes + 1);
+  m_dataPositions[0] = static_cast<int64_t>(ftell(file));
+  for (int j = 0; j < ndes; ++j)
+    m_dataPositions[j + 1] = m_dataPositions[j] + 4 * int64_t(ddes[j].nwords);
   if (!dat1)
     dat1 = new uint32_t[t_ntc1 + 1]; //  space for just one spectrum
   // so when we round up words we get a zero written
@@ -167,6 +174,37 @@ bool ISISRAW2::readData(FILE *file, int i) {
   return true;
 }
 
+/// Position of the data of a spectrum in the file
+/// @param i :: The index of the spectrum in the data
+/// @return The offset of its compressed data from the start of the file
+/// @throw std::out_of_range if there is no such spectrum
+int64_t ISISRAW2::dataPosition(int i) const {
+  if (i < 0 || i >= ndes)
+    throw std::out_of_range("ISISRAW2: no spectrum " + std::to_string(i) +
+                            " in the data");
+  return m_dataPositions[i];
+}
+
+/// Size of the data of a spectrum in the file
+/// @param i :: The index of the spectrum in the data
+/// @return The number of bytes of its compressed data
+/// @throw std::out_of_range if there is no such spectrum
+int64_t ISISRAW2::dataSize(int i) const {
+  return m_dataPositions[i + 1] - dataPosition(i);
+}
+
+/// Expand the compressed data of a spectrum. Unlike readData this does not use
+/// any buffer of the reader, so spectra can be expanded on several threads.
+/// @param compressed :: The compressed data of the spectrum, dataSize(i) bytes
+/// @param i :: The index of the spectrum in the data
+/// @param data :: Set to the t_ntc1 + 1 counts of the spectrum
+void ISISRAW2::expandData(const char *compressed, int i,
+                          uint32_t *data) const {
+  // byte_rel_expn only reads from its input
+  byte_rel_expn(const_cast<char *>(compressed), static_cast<int>(dataSize(i)),
+                0, reinterpret_cast<int *>(data), t_ntc1 + 1);
+}
+
 ISISRAW2::~ISISRAW2() {
   if (outbuff)
     delete[] outbuff;
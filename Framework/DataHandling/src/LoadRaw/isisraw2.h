@@ -8,6 +8,8 @@
 
 #include "isisraw.h"
 
+#include <vector>
+
 /// isis raw file.
 //  isis raw
 class ISISRAW2 : public ISISRAW {
@@ -21,8 +23,15 @@ public:
   bool readData(FILE *file, int i);
   void clear();
 
+  int64_t dataPosition(int i) const;
+  int64_t dataSize(int i) const;
+  void expandData(const char *compressed, int i, uint32_t *data) const;
+
   int ndes; ///< ndes
 private:
   char *outbuff; ///< output buffer
   int m_bufferSize;
+  /// position in the file of the compressed data of each spectrum, followed
+  /// by the end of the data
+  std::vector<int64_t> m_dataPositions;
 };
@@ -17,9 +17,14 @@
 #include "MantidKernel/BoundedValidator.h"
 #include "MantidKernel/ConfigService.h"
 #include "MantidKernel/ListValidator.h"
+#include "MantidKernel/MultiThreaded.h"
 #include "MantidKernel/UnitFactory.h"
 
+#include <Poco/Exception.h>
+#include <Poco/File.h>
 #include <Poco/Path.h>
+#include <Poco/SharedMemory.h>
+#include <algorithm>
 #include <cmath>
 #include <cstdio> //Required for gcc 4.4
 #include <memory>
@@ -28,6 +33,11 @@ namespace Mantid {
 namespace DataHandling {
 DECLARE_FILELOADER_ALGORITHM(LoadRaw3)
 
+namespace {
+/// The number of spectra read between progress reports
+constexpr size_t SPECTRA_PER_BLOCK = 1000;
+} // namespace
+
 using namespace Kernel;
 using namespace API;
 
@@ -37,6 +47,8 @@ LoadRaw3::LoadRaw3()
       m_noTimeRegimes(0), m_prog(0.0), m_prog_start(0.0), m_prog_end(1.0),
       m_lengthIn(0), m_timeChannelsVec(), m_total_specs(0), m_periodList() {}
 
+LoadRaw3::~LoadRaw3() = default;
+
 /// Initialization method.
 void LoadRaw3::init() {
   LoadRawHelper::init();
@@ -103,6 +115,16 @@ void LoadRaw3::exec() {
   std::string title;
   // read workspace title from raw file
   readTitle(file, title);
+  // The spectra are decoded straight from the file mapped into memory where
+  // possible, so that they can be decoded in parallel
+  try {
+    m_mappedFile = std::make_unique<Poco::SharedMemory>(
+        Poco::File(m_filename), Poco::SharedMemory::AM_READ);
+  } catch (Poco::Exception &ex) {
+    g_log.information() << "Unable to map " << m_filename
+                        << " into memory, reading it instead: "
+                        << ex.displayText() << "\n";
+  }
 
   // read workspace dimensions,number of periods etc from the raw file.
   readworkspaceParameters(m_numberOfSpectra, m_numberOfPeriods, m_lengthIn,
@@ -209,12 +231,8 @@ void LoadRaw3::exec() {
   // separate workspace
 
   for (int period = 0; period < m_numberOfPeriods; ++period) {
-    // skipping the first spectra in each period
-    skipData(file, static_cast<int>(period * (m_numberOfSpectra + 1)));
-
     // check for excluded periods
     if (!isPeriodIncluded(period)) {
-      skipPeriod(file, period);
       continue;
     }
 
@@ -300,6 +318,7 @@ void LoadRaw3::exec() {
   } // loop over periods
   // Clean up
 
+  m_mappedFile.reset();
   reset();
   fclose(file);
 }
@@ -312,44 +331,17 @@ void LoadRaw3::exec() {
 void LoadRaw3::excludeMonitors(FILE *file, const int &period,
                                const std::vector<specnum_t> &monitorList,
                                const DataObjects::Workspace2D_sptr &ws_sptr) {
-  int64_t histCurrent = -1;
+  std::vector<SpectrumToLoad> spectra;
   int64_t wsIndex = 0;
-  auto histTotal = static_cast<double>(m_total_specs * m_numberOfPeriods);
   // loop through the spectra
   for (specnum_t i = 1; i <= m_numberOfSpectra; ++i) {
-    specnum_t histToRead = i + period * (m_numberOfSpectra + 1);
-    if ((i >= m_spec_min && i < m_spec_max) ||
-        (m_list && find(m_spec_list.begin(), m_spec_list.end(), i) !=
-                       m_spec_list.end())) {
-      progress(m_prog, "Reading raw file data...");
-      // skip monitor spectrum
-      if (isMonitor(monitorList, i)) {
-        skipData(file, histToRead);
-        continue;
-      }
-
-      // read spectrum
-      if (!readData(file, histToRead)) {
-        throw std::runtime_error("Error reading raw file");
-      }
-      // set the workspace data
-      setWorkspaceData(ws_sptr, m_timeChannelsVec, wsIndex, i, m_noTimeRegimes,
-                       m_lengthIn, 1);
-      // increment workspace index
-      ++wsIndex;
-
-      if (m_numberOfPeriods == 1) {
-        if (++histCurrent % 100 == 0) {
-          setProg(static_cast<double>(histCurrent) / histTotal);
-        }
-        interruption_point();
-      }
-
-    } // end of if loop for spec min,max check
-    else {
-      skipData(file, histToRead);
+    // skip monitor spectrum
+    if (isSpectrumSelected(i) && !isMonitor(monitorList, i)) {
+      const int histToRead = i + period * (m_numberOfSpectra + 1);
+      spectra.push_back({histToRead, i, ws_sptr, wsIndex++});
     }
-  } // end of for loop
+  }
+  loadSpectra(file, spectra);
 }
 
 /**This method creates outputworkspace including monitors
@@ -359,39 +351,17 @@ void LoadRaw3::excludeMonitors(FILE *file, const int &period,
  */
 void LoadRaw3::includeMonitors(FILE *file, const int64_t &period,
                                const DataObjects::Workspace2D_sptr &ws_sptr) {
-
-  int64_t histCurrent = -1;
+  std::vector<SpectrumToLoad> spectra;
   int64_t wsIndex = 0;
-  auto histTotal = static_cast<double>(m_total_specs * m_numberOfPeriods);
   // loop through spectra
   for (specnum_t i = 1; i <= m_numberOfSpectra; ++i) {
-    int64_t histToRead = i + period * (m_numberOfSpectra + 1);
-    if ((i >= m_spec_min && i < m_spec_max) ||
-        (m_list && find(m_spec_list.begin(), m_spec_list.end(), i) !=
-                       m_spec_list.end())) {
-      progress(m_prog, "Reading raw file data...");
-
-      // read spectrum from raw file
-      if (!readData(file, histToRead)) {
-        throw std::runtime_error("Error reading raw file");
-      }
-      // set workspace data
-      setWorkspaceData(ws_sptr, m_timeChannelsVec, wsIndex, i, m_noTimeRegimes,
-                       m_lengthIn, 1);
-      ++wsIndex;
-
-      if (m_numberOfPeriods == 1) {
-        if (++histCurrent % 100 == 0) {
-          setProg(double(histCurrent) / histTotal);
-        }
-        interruption_point();
-      }
-
-    } else {
-      skipData(file, histToRead);
+    if (isSpectrumSelected(i)) {
+      const auto histToRead =
+          static_cast<int>(i + period * (m_numberOfSpectra + 1));
+      spectra.push_back({histToRead, i, ws_sptr, wsIndex++});
     }
   }
-  // loadSpectra(file,period,m_total_specs,ws_sptr,m_timeChannelsVec);
+  loadSpectra(file, spectra);
 }
 
 /** This method separates monitors and creates two outputworkspaces
@@ -406,56 +376,90 @@ void LoadRaw3::separateMonitors(FILE *file, const int64_t &period,
                                 const std::vector<specnum_t> &monitorList,
                                 const DataObjects::Workspace2D_sptr &ws_sptr,
                                 const DataObjects::Workspace2D_sptr &mws_sptr) {
-  int64_t histCurrent = -1;
+  std::vector<SpectrumToLoad> spectra;
   int64_t wsIndex = 0;
   int64_t mwsIndex = 0;
-  auto histTotal = static_cast<double>(m_total_specs * m_numberOfPeriods);
   // loop through spectra
   for (specnum_t i = 1; i <= m_numberOfSpectra; ++i) {
-    int64_t histToRead = i + period * (m_numberOfSpectra + 1);
-    if ((i >= m_spec_min && i < m_spec_max) ||
-        (m_list && find(m_spec_list.begin(), m_spec_list.end(), i) !=
-                       m_spec_list.end())) {
-      progress(m_prog, "Reading raw file data...");
-
-      // read spectrum from raw file
-      if (!readData(file, histToRead)) {
-        throw std::runtime_error("Error reading raw file");
-      }
+    if (isSpectrumSelected(i)) {
+      const auto histToRead =
+          static_cast<int>(i + period * (m_numberOfSpectra + 1));
       // if this a monitor  store that spectrum to monitor workspace
       if (isMonitor(monitorList, i)) {
-        setWorkspaceData(mws_sptr, m_timeChannelsVec, mwsIndex, i,
-                         m_noTimeRegimes, m_lengthIn, 1);
-        ++mwsIndex;
+        spectra.push_back({histToRead, i, mws_sptr, mwsIndex++});
       } else {
         // not a monitor,store the spectrum to normal output workspace
-        setWorkspaceData(ws_sptr, m_timeChannelsVec, wsIndex, i,
-                         m_noTimeRegimes, m_lengthIn, 1);
-        ++wsIndex;
+        spectra.push_back({histToRead, i, ws_sptr, wsIndex++});
       }
-
-      if (m_numberOfPeriods == 1) {
-        if (++histCurrent % 100 == 0) {
-          setProg(static_cast<double>(histCurrent) / histTotal);
-        }
-        interruption_point();
-      }
-
-    } else {
-      skipData(file, histToRead);
     }
   }
+  loadSpectra(file, spectra);
 }
 
-/**
- * Skip all spectra in a period.
+/** Check if a spectrum is selected by the SpectrumMin, SpectrumMax and
+ * SpectrumList properties.
+ * @param spectrumNum :: the spectrum number
+ * @return true if the spectrum is to be loaded
+ */
+bool LoadRaw3::isSpectrumSelected(specnum_t spectrumNum) const {
+  return (spectrumNum >= m_spec_min && spectrumNum < m_spec_max) ||
+         (m_list && find(m_spec_list.begin(), m_spec_list.end(),
+                         spectrumNum) != m_spec_list.end());
+}
+
+/** Read spectra from the file into their workspaces. The data of each spectrum
+ * is found directly from the spectrum descriptors, so the spectra that are not
+ * selected are never touched. If the file is mapped into memory the spectra
+ * are expanded in parallel, otherwise they are read one at a time.
  * @param file :: -pointer to file
- * @param period :: period number
+ * @param spectra :: the spectra to read, in the order they are in the file
  */
-void LoadRaw3::skipPeriod(FILE *file, const int64_t &period) {
-  for (specnum_t i = 1; i <= m_numberOfSpectra; ++i) {
-    int64_t histToRead = i + period * (m_numberOfSpectra + 1);
-    skipData(file, histToRead);
+void LoadRaw3::loadSpectra(FILE *file,
+                           const std::vector<SpectrumToLoad> &spectra) {
+  const auto &isisRawRef = isisRaw();
+  const auto histTotal =
+      static_cast<double>(m_total_specs * m_numberOfPeriods);
+  for (size_t start = 0; start < spectra.size(); start += SPECTRA_PER_BLOCK) {
+    const size_t end = std::min(start + SPECTRA_PER_BLOCK, spectra.size());
+    progress(m_prog, "Reading raw file data...");
+    if (m_mappedFile) {
+      const char *data = m_mappedFile->begin();
+      const auto dataSize = static_cast<int64_t>(m_mappedFile->end() - data);
+      PARALLEL_FOR_NO_WSP_CHECK()
+      for (int64_t j = static_cast<int64_t>(start);
+           j < static_cast<int64_t>(end); ++j) {
+        PARALLEL_START_INTERUPT_REGION
+        const auto &spectrum = spectra[j];
+        const int64_t position = isisRawRef.dataPosition(spectrum.hist);
+        if (position + isisRawRef.dataSize(spectrum.hist) > dataSize)
+          throw std::runtime_error("Error reading raw file, spectrum data is "
+                                   "beyond the end of the file");
+        std::vector<uint32_t> counts(m_lengthIn);
+        isisRawRef.expandData(data + position, spectrum.hist, counts.data());
+        setWorkspaceData(spectrum.workspace, m_timeChannelsVec,
+                         spectrum.wsIndex, spectrum.specNum, m_noTimeRegimes,
+                         m_lengthIn, 1, counts.data());
+        PARALLEL_END_INTERUPT_REGION
+      }
+      PARALLEL_CHECK_INTERUPT_REGION
+    } else {
+      for (size_t j = start; j < end; ++j) {
+        const auto &spectrum = spectra[j];
+        const auto position =
+            static_cast<long>(isisRawRef.dataPosition(spectrum.hist));
+        if (fseek(file, position, SEEK_SET) != 0 ||
+            !readData(file, spectrum.hist)) {
+          throw std::runtime_error("Error reading raw file");
+        }
+        setWorkspaceData(spectrum.workspace, m_timeChannelsVec,
+                         spectrum.wsIndex, spectrum.specNum, m_noTimeRegimes,
+                         m_lengthIn, 1);
+      }
+      interruption_point();
+    }
+    if (m_numberOfPeriods == 1) {
+      setProg(static_cast<double>(end) / histTotal);
+    }
   }
 }
 
@@ -405,12 +405,33 @@ void LoadRawHelper::setWorkspaceData(
         &timeChannelsVec,
     int64_t wsIndex, specnum_t nspecNum, int64_t noTimeRegimes,
     int64_t lengthIn, int64_t binStart) {
+  setWorkspaceData(newWorkspace, timeChannelsVec, wsIndex, nspecNum,
+                   noTimeRegimes, lengthIn, binStart, isisRaw().dat1);
+}
+
+/** This method sets the given counts of a spectrum to workspace vectors. It
+ *  may be called for different spectra on several threads.
+ *  @param newWorkspace :: shared pointer to the  workspace
+ *  @param timeChannelsVec ::  vector holding the X data
+ *  @param  wsIndex  variable used for indexing the output workspace
+ *  @param  nspecNum  spectrum number
+ *  @param noTimeRegimes ::   regime no.
+ *  @param lengthIn :: length of the workspace
+ *  @param binStart :: start of bin
+ *  @param counts :: the lengthIn counts of the spectrum
+ */
+void LoadRawHelper::setWorkspaceData(
+    const DataObjects::Workspace2D_sptr &newWorkspace,
+    const std::vector<std::shared_ptr<HistogramData::HistogramX>>
+        &timeChannelsVec,
+    int64_t wsIndex, specnum_t nspecNum, int64_t noTimeRegimes,
+    int64_t lengthIn, int64_t binStart, const uint32_t *counts) const {
   if (!newWorkspace)
     return;
 
   // But note that the last (overflow) bin is kept
   auto &Y = newWorkspace->mutableY(wsIndex);
-  Y.assign(isisRaw().dat1 + binStart, isisRaw().dat1 + lengthIn);
+  Y.assign(counts + binStart, counts + lengthIn);
   // Fill the vector for the errors, containing sqrt(count)
   newWorkspace->setCountVariances(wsIndex, Y.rawData());
 
@@ -430,9 +451,9 @@ void LoadRawHelper::setWorkspaceData(
     newWorkspace->setX(wsIndex, timeChannelsVec[0]);
   else {
 
-    // Use std::vector::at just incase spectrum missing from spec array
+    // Use at just incase spectrum missing from spec array
     newWorkspace->setX(wsIndex,
-                       timeChannelsVec.at(m_specTimeRegimes[nspecNum] - 1));
+                       timeChannelsVec.at(m_specTimeRegimes.at(nspecNum) - 1));
   }
 }
 
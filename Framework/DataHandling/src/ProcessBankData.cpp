@@ -4,6 +4,7 @@
 //   NScD Oak Ridge National Laboratory, European Spallation Source,
 //   Institut Laue - Langevin & CSNS, Institute of High Energy Physics, CAS
 // SPDX - License - Identifier: GPL - 3.0 +
+#include <algorithm>
 #include <utility>
 
 #include "MantidDataHandling/DefaultEventLoader.h"
@@ -89,21 +90,30 @@ void ProcessBankData::run() { // override {
         counts[thisId - m_min_id]++;
     }
 
-    // Now we pre-allocate (reserve) the vectors of events in each pixel
-    // counted
+    // Find the the workspace index corresponding to each pixel counted.
+    // Several pixels can map onto the same spectrum, so add up their counts
+    // before reserving, to allocate each vector of events only once.
     const size_t numEventLists = outputWS.getNumberHistograms();
+    std::vector<std::pair<size_t, size_t>> wiCounts;
     for (detid_t pixID = m_min_id; pixID <= m_max_id; ++pixID) {
       if (counts[pixID - m_min_id] > 0) {
         size_t wi = getWorkspaceIndexFromPixelID(pixID);
-        // Find the the workspace index corresponding to that pixel ID
-        // Allocate it
-        if (wi < numEventLists) {
-          outputWS.reserveEventListAt(wi, counts[pixID - m_min_id]);
-        }
-        if (alg->getCancel())
-          break; // User cancellation
+        if (wi < numEventLists)
+          wiCounts.emplace_back(wi, counts[pixID - m_min_id]);
       }
     }
+    std::sort(wiCounts.begin(), wiCounts.end());
+
+    // Now we pre-allocate (reserve) the vectors of events in each spectrum
+    for (size_t i = 0; i < wiCounts.size();) {
+      const size_t wi = wiCounts[i].first;
+      size_t total = 0;
+      for (; i < wiCounts.size() && wiCounts[i].first == wi; ++i)
+        total += wiCounts[i].second;
+      outputWS.reserveEventListAt(wi, total);
+      if (alg->getCancel())
+        break; // User cancellation
+    }
   }
 
   // Check for canceled algorithm
@@ -124,6 +134,17 @@ void ProcessBankData::run() { // override {
 
   // Will we need to compress?
   const bool compress = (alg->compressTolerance >= 0);
+  // Keeping a coarse pulse time?
+  const bool compressFat = (alg->compressWallClockTolerance != EMPTY_DBL());
+  // Wall-clock bins reaching back to the first pulse of this bank
+  auto compressStartTime = alg->compressStartTime;
+  if (compress && compressFat && NUM_PULSES > 0) {
+    const auto firstPulse =
+        *std::min_element(thisBankPulseTimes->pulseTimes,
+                          thisBankPulseTimes->pulseTimes + NUM_PULSES);
+    compressStartTime = LoadEventNexus::compressStartTimeFor(
+        compressStartTime, firstPulse, alg->compressWallClockTolerance);
+  }
 
   // Which detector IDs were touched? - only matters if compress is on
   std::vector<bool> usedDetIds;
@@ -231,7 +252,10 @@ void ProcessBankData::run() { // override {
         // Find the the workspace index corresponding to that pixel ID
         size_t wi = getWorkspaceIndexFromPixelID(pixID);
         auto &el = outputWS.getSpectrum(wi);
-        if (compress)
+        if (compress && compressFat)
+          el.compressFatEvents(alg->compressTolerance, compressStartTime,
+                               alg->compressWallClockTolerance, &el);
+        else if (compress)
           el.compressEvents(alg->compressTolerance, &el);
         else {
           if (pulsetimesincreasing)
@@ -19,7 +19,11 @@
 #include "MantidGeometry/Crystal/AngleUnits.h"
 #include "MantidKernel/ArrayProperty.h"
 #include "MantidKernel/BoundedValidator.h"
+#include "MantidKernel/EnabledWhenProperty.h"
 #include "MantidNexus/NexusFileIO.h"
+#include <array>
+#include <functional>
+#include <future>
 #include <memory>
 #include <utility>
 
@@ -161,6 +165,26 @@ void SaveNexusProcessed::init() {
       "CompressNexus",
       std::make_unique<EnabledWhenWorkspaceIsType<EventWorkspace>>(
           "InputWorkspace", true));
+
+  auto compressionLevel = std::make_shared<BoundedValidator<int>>(1, 9);
+  declareProperty("CompressionLevel", 6, compressionLevel,
+                  "For EventWorkspaces saved with CompressNexus, the deflate "
+                  "level from 1 (fastest) to 9 (smallest files).");
+  setPropertySettings("CompressionLevel",
+                      std::make_unique<EnabledWhenProperty>(
+                          "CompressNexus", IS_EQUAL_TO, "1"));
+
+  auto mustBeAboveZero = std::make_shared<BoundedValidator<int>>();
+  mustBeAboveZero->setLower(1);
+  declareProperty(
+      "EventBlockSize", 1 << 20, mustBeAboveZero,
+      "For EventWorkspaces, the number of events written at a time. This is\n"
+      "also the size of the chunks that are compressed. Twice this number of\n"
+      "events are held in memory while saving.");
+  setPropertySettings(
+      "EventBlockSize",
+      std::make_unique<EnabledWhenWorkspaceIsType<EventWorkspace>>(
+          "InputWorkspace", true));
 }
 
 /** Get the list of workspace indices to use
@@ -396,28 +420,29 @@ void SaveNexusProcessed::exec() {
 }
 
 //-------------------------------------------------------------------------------------
-/** Append out each field of a vector of events to separate array.
+/** Append out each field of a range of events to separate arrays.
  *
  * @param events :: vector of TofEvent or WeightedEvent, etc.
+ * @param first :: index of the first event to append
+ * @param last :: index of the last event to append + 1
  * @param offset :: where the first event goes in the array
  * @param tofs, weights, errorSquareds, pulsetimes :: arrays to write to.
  *        Must be initialized and big enough,
  *        or NULL if they are not meant to be written to.
  */
 template <class T>
-void SaveNexusProcessed::appendEventListData(const std::vector<T> &events,
-                                             size_t offset, double *tofs,
-                                             float *weights,
-                                             float *errorSquareds,
-                                             int64_t *pulsetimes) {
+void SaveNexusProcessed::appendEventListData(
+    const std::vector<T> &events, const size_t first, const size_t last,
+    size_t offset, double *tofs, float *weights, float *errorSquareds,
+    int64_t *pulsetimes) {
   // Do nothing if there are no events.
-  if (events.empty())
+  if (first >= last)
     return;
 
-  const auto it = events.cbegin();
-  const auto it_end = events.cend();
+  const auto it = std::next(events.cbegin(), first);
+  const auto it_end = std::next(events.cbegin(), last);
 
-  // Fill the C-arrays with the fields from all the events, as requested.
+  // Fill the C-arrays with the fields from the events, as requested.
   if (tofs) {
     std::transform(it, it_end, std::next(tofs, offset),
                    [](const T &event) { return event.tof(); });
@@ -440,9 +465,76 @@ void SaveNexusProcessed::appendEventListData(const std::vector<T> &events,
   }
 }
 
+//-----------------------------------------------------------------------------------------------
+/** Copy the fields of a block of consecutive events, which may start and end
+ * part way through a spectrum, into the arrays of the block.
+ *
+ * @param indices :: index of the first event of each spectrum, followed by
+ * the total number of events
+ * @param start :: index of the first event of the block
+ * @param count :: number of events in the block
+ * @param block :: the arrays to fill. Empty arrays are not written to.
+ */
+void SaveNexusProcessed::fillEventBlock(const std::vector<int64_t> &indices,
+                                        const int64_t start,
+                                        const int64_t count,
+                                        EventBlock &block) {
+  const int64_t stop = start + count;
+  // The spectra holding the first and last events of the block
+  const auto firstSpectrum = static_cast<int>(
+      std::distance(indices.cbegin(), std::upper_bound(indices.cbegin(),
+                                                       indices.cend(), start)) -
+      1);
+  const auto lastSpectrum = static_cast<int>(
+      std::distance(indices.cbegin(), std::lower_bound(indices.cbegin(),
+                                                       indices.cend(), stop)));
+  auto *tofs = block.tofs.empty() ? nullptr : block.tofs.data();
+  auto *weights = block.weights.empty() ? nullptr : block.weights.data();
+  auto *errorSquareds =
+      block.errorSquareds.empty() ? nullptr : block.errorSquareds.data();
+  auto *pulsetimes =
+      block.pulsetimes.empty() ? nullptr : block.pulsetimes.data();
+
+  PARALLEL_FOR_NO_WSP_CHECK()
+  for (int wi = firstSpectrum; wi < lastSpectrum; wi++) {
+    PARALLEL_START_INTERUPT_REGION
+    const DataObjects::EventList &el = m_eventWorkspace->getSpectrum(wi);
+    // The part of this spectrum in the block, and where it lands in the
+    // arrays. It is okay to write in parallel since none overlap.
+    const int64_t sliceStart = std::max(indices[wi], start);
+    const int64_t sliceStop = std::min(indices[wi + 1], stop);
+    if (sliceStart < sliceStop) {
+      const auto first = static_cast<size_t>(sliceStart - indices[wi]);
+      const auto last = static_cast<size_t>(sliceStop - indices[wi]);
+      const auto offset = static_cast<size_t>(sliceStart - start);
+
+      switch (el.getEventType()) {
+      case TOF:
+        appendEventListData(el.getEvents(), first, last, offset, tofs, weights,
+                            errorSquareds, pulsetimes);
+        break;
+      case WEIGHTED:
+        appendEventListData(el.getWeightedEvents(), first, last, offset, tofs,
+                            weights, errorSquareds, pulsetimes);
+        break;
+      case WEIGHTED_NOTIME:
+        appendEventListData(el.getWeightedEventsNoTime(), first, last, offset,
+                            tofs, weights, errorSquareds, pulsetimes);
+        break;
+      }
+      m_progress->reportIncrement(last - first, "Copying EventList");
+    }
+    PARALLEL_END_INTERUPT_REGION
+  }
+  PARALLEL_CHECK_INTERUPT_REGION
+}
+
 //-----------------------------------------------------------------------------------------------
 /** Execute the saving of event data.
- * This will make one long event list for all events contained.
+ * The events of all the spectra are written as one long event list, in blocks
+ * of a fixed number of events. Each block is filled while the one before is
+ * written, so no more than two blocks are held in memory whatever the number
+ * of events.
  * */
 void SaveNexusProcessed::execEvent(Mantid::NeXus::NexusFileIO *nexusFile,
                                    const bool uniformSpectra,
@@ -454,7 +546,6 @@ void SaveNexusProcessed::execEvent(Mantid::NeXus::NexusFileIO *nexusFile,
   nexusFile->writeNexusProcessedData2D(m_eventWorkspace, uniformSpectra, spec,
                                        "event_workspace", false);
 
-  // Make a super long list of tofs, weights, etc.
   std::vector<int64_t> indices;
   indices.reserve(m_eventWorkspace->getNumberHistograms() + 1);
   // First we need to index the events in each spectrum
@@ -466,90 +557,63 @@ void SaveNexusProcessed::execEvent(Mantid::NeXus::NexusFileIO *nexusFile,
     index += m_eventWorkspace->getSpectrum(wi).getNumberEvents();
   }
   indices.emplace_back(index);
-
-  // Initialize all the arrays
-  int64_t num = index;
-  double *tofs = nullptr;
-  float *weights = nullptr;
-  float *errorSquareds = nullptr;
-  int64_t *pulsetimes = nullptr;
+  const auto numEvents = static_cast<int64_t>(index);
 
   // overall event type.
   EventType type = m_eventWorkspace->getEventType();
-  bool writeTOF = true;
-  bool writePulsetime = false;
-  bool writeWeight = false;
-  bool writeError = false;
-
-  switch (type) {
-  case TOF:
-    writePulsetime = true;
-    break;
-  case WEIGHTED:
-    writePulsetime = true;
-    writeWeight = true;
-    writeError = true;
-    break;
-  case WEIGHTED_NOTIME:
-    writeWeight = true;
-    writeError = true;
-    break;
-  }
+  const bool writePulsetime = type != WEIGHTED_NOTIME;
+  const bool writeWeights = type != TOF;
 
-  // --- Initialize the combined event arrays ----
-  if (writeTOF)
-    tofs = new double[num];
-  if (writeWeight)
-    weights = new float[num];
-  if (writeError)
-    errorSquareds = new float[num];
-  if (writePulsetime)
-    pulsetimes = new int64_t[num];
-
-  // --- Fill in the combined event arrays ----
-  PARALLEL_FOR_NO_WSP_CHECK()
-  for (int wi = 0;
-       wi < static_cast<int>(m_eventWorkspace->getNumberHistograms()); wi++) {
-    PARALLEL_START_INTERUPT_REGION
-    const DataObjects::EventList &el = m_eventWorkspace->getSpectrum(wi);
-
-    // This is where it will land in the output array.
-    // It is okay to write in parallel since none should step on each other.
-    size_t offset = indices[wi];
-
-    switch (el.getEventType()) {
-    case TOF:
-      appendEventListData(el.getEvents(), offset, tofs, weights, errorSquareds,
-                          pulsetimes);
-      break;
-    case WEIGHTED:
-      appendEventListData(el.getWeightedEvents(), offset, tofs, weights,
-                          errorSquareds, pulsetimes);
-      break;
-    case WEIGHTED_NOTIME:
-      appendEventListData(el.getWeightedEventsNoTime(), offset, tofs, weights,
-                          errorSquareds, pulsetimes);
-      break;
+  /*Default = DONT compress - much faster*/
+  const bool compressNexus = getProperty("CompressNexus");
+  const int compressionLevel =
+      compressNexus ? static_cast<int>(getProperty("CompressionLevel")) : 0;
+  const int blockSize = getProperty("EventBlockSize");
+
+  nexusFile->makeNexusProcessedDataEventFields(
+      m_eventWorkspace, indices, blockSize, compressionLevel, writePulsetime,
+      writeWeights);
+
+  // --- Allocate the arrays of the two blocks being filled and written ----
+  const auto blockLength =
+      static_cast<size_t>(std::min<int64_t>(blockSize, numEvents));
+  std::array<EventBlock, 2> blocks;
+  for (auto &block : blocks) {
+    block.tofs.resize(blockLength);
+    if (writePulsetime)
+      block.pulsetimes.resize(blockLength);
+    if (writeWeights) {
+      block.weights.resize(blockLength);
+      block.errorSquareds.resize(blockLength);
     }
-    m_progress->reportIncrement(el.getNumberEvents(), "Copying EventList");
-
-    PARALLEL_END_INTERUPT_REGION
   }
-  PARALLEL_CHECK_INTERUPT_REGION
 
-  /*Default = DONT compress - much faster*/
-  bool CompressNexus = getProperty("CompressNexus");
-
-  // Write out to the NXS file.
-  nexusFile->writeNexusProcessedDataEventCombined(m_eventWorkspace, indices,
-                                                  tofs, weights, errorSquareds,
-                                                  pulsetimes, CompressNexus);
-
-  // Free mem.
-  delete[] tofs;
-  delete[] weights;
-  delete[] errorSquareds;
-  delete[] pulsetimes;
+  // --- Write out each block while filling in the next ----
+  std::future<void> filling;
+  const auto fillBlock = [&](const int64_t start, EventBlock &block) {
+    const auto count = std::min<int64_t>(blockSize, numEvents - start);
+    filling = std::async(std::launch::async,
+                         &SaveNexusProcessed::fillEventBlock, this,
+                         std::cref(indices), start, count, std::ref(block));
+  };
+  if (numEvents > 0)
+    fillBlock(0, blocks[0]);
+  size_t current = 0;
+  for (int64_t start = 0; start < numEvents; start += blockSize) {
+    filling.get();
+    auto &block = blocks[current];
+    current = 1 - current;
+    if (start + blockSize < numEvents)
+      fillBlock(start + blockSize, blocks[current]);
+
+    const auto count = std::min<int64_t>(blockSize, numEvents - start);
+    nexusFile->writeNexusProcessedDataEventBlock(
+        start, count, block.tofs.data(),
+        writeWeights ? block.weights.data() : nullptr,
+        writeWeights ? block.errorSquareds.data() : nullptr,
+        writePulsetime ? block.pulsetimes.data() : nullptr);
+    m_progress->reportIncrement(static_cast<size_t>(count), "Writing events");
+  }
 }
 
 //-----------------------------------------------------------------------------------------------
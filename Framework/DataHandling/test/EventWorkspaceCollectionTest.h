@@ -173,4 +173,76 @@ public:
       TS_ASSERT_EQUALS(eventWS->sample().getThickness(), thickness);
     }
   }
+
+  void test_reserveEventListAt_adds_to_existing_events() {
+    EventWorkspaceCollection collection;
+    collection.setIndexInfo(Indexing::IndexInfo(1));
+    auto &eventList = collection.getSingleHeldWorkspace()->getSpectrum(0);
+    eventList.reserve(10);
+    for (int i = 0; i < 10; ++i)
+      eventList += Types::Event::TofEvent(static_cast<double>(i));
+
+    collection.reserveEventListAt(0, 5);
+    TS_ASSERT_EQUALS(eventList.getNumberEvents(), 10);
+    TS_ASSERT_LESS_THAN_EQUALS(15, eventList.capacity());
+  }
+
+  void test_reserveEventListAt_grows_geometrically() {
+    EventWorkspaceCollection collection;
+    collection.setIndexInfo(Indexing::IndexInfo(1));
+    auto &eventList = collection.getSingleHeldWorkspace()->getSpectrum(0);
+    size_t reallocations = 0;
+    for (int i = 0; i < 1000; ++i) {
+      const size_t capacity = eventList.capacity();
+      collection.reserveEventListAt(0, 1);
+      if (eventList.capacity() != capacity)
+        ++reallocations;
+      eventList += Types::Event::TofEvent(static_cast<double>(i));
+    }
+    TS_ASSERT_EQUALS(eventList.getNumberEvents(), 1000);
+    TS_ASSERT_LESS_THAN(reallocations, 20);
+  }
+};
+
+class EventWorkspaceCollectionTestPerformance : public CxxTest::TestSuite {
+public:
+  // This pair of boilerplate methods prevent the suite being created statically
+  // This means the constructor isn't called when running other tests
+  static EventWorkspaceCollectionTestPerformance *createSuite() {
+    return new EventWorkspaceCollectionTestPerformance();
+  }
+  static void destroySuite(EventWorkspaceCollectionTestPerformance *suite) {
+    delete suite;
+  }
+
+  void setUp() override {
+    m_collection = std::make_unique<EventWorkspaceCollection>();
+    m_collection->setIndexInfo(Indexing::IndexInfo(NUM_SPECTRA));
+  }
+
+  void test_fill_without_reserve() {
+    // Two halves, as when two banks feed the same spectra
+    fill(EVENTS_PER_SPECTRUM / 2);
+    fill(EVENTS_PER_SPECTRUM / 2);
+  }
+
+  void test_fill_with_reserve() {
+    for (int bank = 0; bank < 2; ++bank) {
+      for (size_t wi = 0; wi < NUM_SPECTRA; ++wi)
+        m_collection->reserveEventListAt(wi, EVENTS_PER_SPECTRUM / 2);
+      fill(EVENTS_PER_SPECTRUM / 2);
+    }
+  }
+
+private:
+  void fill(const size_t eventsPerSpectrum) {
+    auto ws = m_collection->getSingleHeldWorkspace();
+    for (size_t i = 0; i < eventsPerSpectrum; ++i)
+      for (size_t wi = 0; wi < NUM_SPECTRA; ++wi)
+        ws->getSpectrum(wi) += Types::Event::TofEvent(static_cast<double>(i));
+  }
+
+  static constexpr size_t NUM_SPECTRA = 10000;
+  static constexpr size_t EVENTS_PER_SPECTRUM = 1000;
+  std::unique_ptr<EventWorkspaceCollection> m_collection;
 };
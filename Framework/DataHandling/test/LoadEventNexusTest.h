@@ -456,6 +456,48 @@ public:
     }
   }
 
+  void test_ExactPrecount_vs_Precount() {
+    const std::string filename = "CNCS_7860_event.nxs";
+    auto ws = std::dynamic_pointer_cast<EventWorkspace>(
+        loadWithPrecount(filename, "Precount"));
+    auto ws2 = std::dynamic_pointer_cast<EventWorkspace>(
+        loadWithPrecount(filename, "ExactPrecount"));
+    TS_ASSERT(ws);
+    TS_ASSERT(ws2);
+    if (!ws || !ws2)
+      return;
+    TS_ASSERT_EQUALS(ws2->getNumberEvents(), 112266);
+    TS_ASSERT_EQUALS(ws->getNumberHistograms(), ws2->getNumberHistograms());
+    for (size_t i = 0; i < ws2->getNumberHistograms(); ++i) {
+      TS_ASSERT_EQUALS(ws->getSpectrum(i).getEvents(),
+                       ws2->getSpectrum(i).getEvents());
+      checkAllocatedExactly(ws2->getSpectrum(i));
+    }
+    TS_ASSERT_LESS_THAN_EQUALS(ws2->getMemorySize(), ws->getMemorySize());
+  }
+
+  void test_ExactPrecount_with_periods() {
+    const std::string filename = "LARMOR00003368.nxs";
+    auto group = std::dynamic_pointer_cast<WorkspaceGroup>(
+        loadWithPrecount(filename, "Precount"));
+    auto group2 = std::dynamic_pointer_cast<WorkspaceGroup>(
+        loadWithPrecount(filename, "ExactPrecount"));
+    TS_ASSERT(group);
+    TS_ASSERT(group2);
+    if (!group || !group2)
+      return;
+    TS_ASSERT_EQUALS(group->size(), group2->size());
+    for (size_t period = 0; period < group2->size(); ++period) {
+      auto ws =
+          std::dynamic_pointer_cast<EventWorkspace>(group->getItem(period));
+      auto ws2 =
+          std::dynamic_pointer_cast<EventWorkspace>(group2->getItem(period));
+      TS_ASSERT_EQUALS(ws->getNumberEvents(), ws2->getNumberEvents());
+      for (size_t i = 0; i < ws2->getNumberHistograms(); ++i)
+        checkAllocatedExactly(ws2->getSpectrum(i));
+    }
+  }
+
   void test_TOF_filtered_loading() {
     const std::string wsName = "test_filtering";
     const double filterStart = 45000;
@@ -646,6 +688,47 @@ public:
     AnalysisDataService::Instance().remove(wsName2);
   }
 
+  void test_partial_spectra_loading_of_one_bank() {
+    // The other banks have no pixels in the range, so are not read at all
+    LoadEventNexus ld;
+    ld.setChild(true);
+    ld.initialize();
+    ld.setPropertyValue("OutputWorkspace", "dummy");
+    ld.setPropertyValue("Filename", "CNCS_7860_event.nxs");
+    ld.setProperty("SpectrumMin", 35 * 1024);
+    ld.setProperty("SpectrumMax", 36 * 1024 - 1);
+    ld.setProperty<bool>("LoadLogs", false); // Time-saver
+    TS_ASSERT(ld.execute());
+    Workspace_sptr outWS = ld.getProperty("OutputWorkspace");
+    auto ws = std::dynamic_pointer_cast<EventWorkspace>(outWS);
+    TS_ASSERT(ws);
+    if (!ws)
+      return;
+    TS_ASSERT_EQUALS(ws->getNumberHistograms(), 1024);
+    // The same events as loading bank36 by name
+    TS_ASSERT_EQUALS(ws->getNumberEvents(), 7274);
+  }
+
+  void test_spectrum_list_skips_banks_by_their_event_ids() {
+    // Only bank36 has event IDs that map to the listed spectra
+    const auto loadEvents = [](const std::string &property,
+                               const std::string &value) {
+      LoadEventNexus ld;
+      ld.setChild(true);
+      ld.initialize();
+      ld.setPropertyValue("OutputWorkspace", "dummy");
+      ld.setPropertyValue("Filename", "CNCS_7860_event.nxs");
+      ld.setPropertyValue(property, value);
+      ld.setProperty<bool>("LoadLogs", false); // Time-saver
+      TS_ASSERT(ld.execute());
+      EventWorkspace_sptr ws = ld.getProperty("OutputWorkspace");
+      return ws ? ws->getNumberEvents() : 0;
+    };
+    const auto listed = loadEvents("SpectrumList", "35840-36863");
+    TS_ASSERT_EQUALS(listed, 7274);
+    TS_ASSERT_EQUALS(listed, loadEvents("BankName", "bank36"));
+  }
+
   void test_CNCSMonitors() {
     // Re-uses the workspace loaded in test_partial_spectra_loading to save a
     // load execution
@@ -735,6 +818,80 @@ public:
         ads.retrieveWS<MatrixWorkspace>("cncs_compressed")->monitorWorkspace());
   }
 
+  void test_Load_And_CompressEvents_with_wall_clock_tolerance() {
+    Mantid::API::FrameworkManager::Instance();
+    LoadEventNexus ld;
+    std::string outws_name = "cncs_compressed_wallclock";
+    ld.initialize();
+    ld.setPropertyValue("Filename", "CNCS_7860_event.nxs");
+    ld.setPropertyValue("OutputWorkspace", outws_name);
+    ld.setPropertyValue("CompressTolerance", "0.05");
+    ld.setPropertyValue("CompressWallClockTolerance", "10");
+    ld.setProperty<bool>("LoadLogs", false); // Time-saver
+    ld.execute();
+    TS_ASSERT(ld.isExecuted());
+
+    EventWorkspace_sptr WS;
+    TS_ASSERT_THROWS_NOTHING(
+        WS = AnalysisDataService::Instance().retrieveWS<EventWorkspace>(
+            outws_name));
+    TS_ASSERT(WS);
+    if (!WS)
+      return;
+    // Fewer events than loaded, but no fewer than compressing without
+    // keeping the pulse time
+    TS_ASSERT_LESS_THAN(WS->getNumberEvents(), 112266);
+    TS_ASSERT_LESS_THAN_EQUALS(111274, WS->getNumberEvents());
+    double totalWeight = 0.;
+    for (size_t wi = 0; wi < WS->getNumberHistograms(); wi++) {
+      const auto &el = WS->getSpectrum(wi);
+      // Pixels with at least one event keep their pulse times
+      if (el.getNumberEvents() > 0)
+        TS_ASSERT_EQUALS(el.getEventType(), WEIGHTED);
+      for (const auto weight : el.getWeights())
+        totalWeight += weight;
+    }
+    TS_ASSERT_DELTA(totalWeight, 112266., 1e-6);
+    AnalysisDataService::Instance().remove(outws_name);
+  }
+
+  void test_compressStartTimeFor() {
+    const DateAndTime runStart("2010-01-01T00:01:40");
+    // Pulses after the run start leave the bins starting with the run
+    TS_ASSERT_EQUALS(LoadEventNexus::compressStartTimeFor(
+                         runStart, runStart + 5.0, 1.0),
+                     runStart);
+    // Otherwise the bins are extended back by whole bins
+    TS_ASSERT_EQUALS(LoadEventNexus::compressStartTimeFor(
+                         runStart, runStart - 2.5, 1.0),
+                     runStart - 3.0);
+    TS_ASSERT_EQUALS(LoadEventNexus::compressStartTimeFor(
+                         runStart, runStart - 2.0, 1.0),
+                     runStart - 2.0);
+  }
+
+  void test_compress_with_wall_clock_tolerance_keeps_pulses_before_run_start() {
+    const DateAndTime runStart("2010-01-01T00:01:40");
+    EventList el;
+    // One event per pulse, at 0.5 s intervals from 3 s before the run start
+    for (int i = 0; i < 12; ++i)
+      el += TofEvent(100., runStart + (0.5 * i - 3.0));
+    const double tolerance = 1.0;
+    const auto startTime = LoadEventNexus::compressStartTimeFor(
+        runStart, el.getPulseTimeMin(), tolerance);
+
+    EventList compressed;
+    el.compressFatEvents(0.05, startTime, tolerance, &compressed);
+    // Two pulses per wall-clock bin, and no events dropped
+    TS_ASSERT_EQUALS(compressed.getNumberEvents(), 6);
+    TS_ASSERT_DELTA(compressed.getTofMin(), 100., 1e-10);
+    double totalWeight = 0.;
+    for (const auto weight : compressed.getWeights())
+      totalWeight += weight;
+    TS_ASSERT_DELTA(totalWeight, 12., 1e-10);
+    TS_ASSERT_LESS_THAN(compressed.getPulseTimeMin(), runStart);
+  }
+
   void doTestSingleBank(bool SingleBankPixelsOnly, bool Precount,
                         const std::string &BankName = "bank36",
                         bool willFail = false) {
@@ -1046,6 +1203,27 @@ public:
   }
 
 private:
+  /// Load a file, pre-counting the events with the given option
+  Workspace_sptr loadWithPrecount(const std::string &filename,
+                                  const std::string &option) {
+    LoadEventNexus ld;
+    ld.setChild(true);
+    ld.initialize();
+    ld.setPropertyValue("Filename", filename);
+    ld.setPropertyValue("OutputWorkspace", "dummy");
+    ld.setProperty<bool>("Precount", false);
+    ld.setProperty<bool>(option, true);
+    TS_ASSERT_THROWS_NOTHING(ld.execute());
+    return ld.getProperty("OutputWorkspace");
+  }
+
+  /// Check that no more memory was allocated than the events need
+  void checkAllocatedExactly(const EventList &eventList) {
+    TS_ASSERT_EQUALS(eventList.getMemorySize(),
+                     eventList.getNumberEvents() * sizeof(TofEvent) +
+                         sizeof(EventList));
+  }
+
   std::string wsSpecFilterAndEventMonitors;
 };
 
@@ -292,6 +292,80 @@ public:
     TS_ASSERT_EQUALS(endTime.totalNanoseconds(), lastTime.totalNanoseconds());
   }
 
+  void test_allow_list_selects_logs() {
+    LoadNexusLogs ld;
+    ld.initialize();
+    ld.setPropertyValue("Filename", "REF_L_32035.nxs");
+    MatrixWorkspace_sptr ws = createTestWorkspace();
+    ld.setProperty("Workspace", ws);
+    ld.setPropertyValue("AllowList", "Phase1,PhaseRequest*");
+    ld.execute();
+    TS_ASSERT(ld.isExecuted());
+
+    const auto &run = ws->run();
+    TS_ASSERT(run.hasProperty("Phase1"));
+    TS_ASSERT(run.hasProperty("PhaseRequest1"));
+    TS_ASSERT(!run.hasProperty("Phase2"));
+    TS_ASSERT(!run.hasProperty("Speed3"));
+    auto tsp = dynamic_cast<TimeSeriesProperty<double> *>(
+        run.getLogData("PhaseRequest1"));
+    TS_ASSERT(tsp);
+    TS_ASSERT_DELTA(tsp->nthValue(0), 13712.77, 1e-2);
+  }
+
+  void test_block_list_skips_logs() {
+    LoadNexusLogs ld;
+    ld.initialize();
+    ld.setPropertyValue("Filename", "REF_L_32035.nxs");
+    MatrixWorkspace_sptr ws = createTestWorkspace();
+    ld.setProperty("Workspace", ws);
+    ld.setPropertyValue("BlockList", "Phase?");
+    ld.execute();
+    TS_ASSERT(ld.isExecuted());
+
+    // Every log of the file is kept but the ones matching the pattern
+    LoadNexusLogs all;
+    all.initialize();
+    all.setPropertyValue("Filename", "REF_L_32035.nxs");
+    MatrixWorkspace_sptr allWS = createTestWorkspace();
+    all.setProperty("Workspace", allWS);
+    all.execute();
+    TS_ASSERT(all.isExecuted());
+    const auto allLogs = allWS->run().getLogData();
+    TS_ASSERT_EQUALS(allLogs.size(), 75);
+
+    const auto &run = ws->run();
+    size_t numBlocked = 0;
+    for (const auto *log : allLogs) {
+      const auto &name = log->name();
+      const bool blocked = name.size() == 6 && name.compare(0, 5, "Phase") == 0;
+      if (blocked)
+        ++numBlocked;
+      TSM_ASSERT_EQUALS(name, run.hasProperty(name), !blocked);
+    }
+    TS_ASSERT_LESS_THAN(0, numBlocked);
+    TS_ASSERT_EQUALS(run.getLogData().size(), allLogs.size() - numBlocked);
+    TS_ASSERT(!run.hasProperty("Phase1"));
+    TS_ASSERT(run.hasProperty("PhaseRequest1"));
+    TS_ASSERT(run.hasProperty("Speed3"));
+  }
+
+  void test_block_list_on_isis_file() {
+    LoadNexusLogs loader;
+    loader.initialize();
+    MatrixWorkspace_sptr testWS = createTestWorkspace();
+    loader.setProperty("Workspace", testWS);
+    loader.setPropertyValue("Filename", "LOQ49886.nxs");
+    loader.setPropertyValue("BlockList", "icp_*");
+    TS_ASSERT_THROWS_NOTHING(loader.execute());
+    TS_ASSERT(loader.isExecuted());
+
+    const auto &run = testWS->run();
+    TS_ASSERT(!run.hasProperty("icp_event"));
+    TS_ASSERT(!run.hasProperty("icp_debug"));
+    TS_ASSERT(run.hasProperty("proton_charge"));
+  }
+
 private:
   API::MatrixWorkspace_sptr createTestWorkspace() {
     return WorkspaceFactory::Instance().create("Workspace2D", 1, 1, 1);
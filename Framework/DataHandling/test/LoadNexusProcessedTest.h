@@ -238,14 +238,16 @@ public:
       Poco::File(filename).remove();
   }
 
-  void dotest_LoadAnEventFile(EventType type) {
+  void dotest_LoadAnEventFile(EventType type, bool compress = false,
+                              int eventBlockSize = 1 << 20) {
     std::string filename_root = "LoadNexusProcessed_ExecEvent_";
 
     // Call a function that writes out the file
     std::string outputFile;
     EventWorkspace_sptr origWS =
         SaveNexusProcessedTest::do_testExec_EventWorkspaces(
-            filename_root, type, outputFile, false, false);
+            filename_root, type, outputFile, false, false, true, compress,
+            eventBlockSize);
 
     LoadNexusProcessed alg;
     TS_ASSERT_THROWS_NOTHING(alg.initialize());
@@ -314,6 +316,12 @@ public:
     dotest_LoadAnEventFile(WEIGHTED_NOTIME);
   }
 
+  void test_LoadEventNexus_saved_in_compressed_blocks() {
+    // Blocks of 7 events start and end part way through spectra
+    dotest_LoadAnEventFile(TOF, true, 7);
+    dotest_LoadAnEventFile(WEIGHTED, true, 7);
+  }
+
   void test_loadEventNexus_Min() {
     writeTmpEventNexus();
 
@@ -936,6 +944,43 @@ public:
     doTestLoadAndSavePointWS(true);
   }
 
+  void test_SaveAndLoadOnHistogramWS_keeps_shared_bins() {
+    // Spectra 0-2 and 3-4 share bins, which differ between the two sets
+    MatrixWorkspace_sptr inputWs =
+        WorkspaceCreationHelper::create2DWorkspaceBinned(5, 3, 1.0, 1.0);
+    for (size_t i = 0; i < 5; ++i)
+      inputWs->mutableY(i) = static_cast<double>(i);
+    inputWs->mutableX(3) = {2.0, 4.0, 6.0, 8.0};
+    inputWs->setSharedX(4, inputWs->sharedX(3));
+    const std::string filename = "TestSaveAndLoadSharedBins.nxs";
+
+    auto save = AlgorithmManager::Instance().create("SaveNexusProcessed");
+    save->initialize();
+    save->setProperty("InputWorkspace", inputWs);
+    save->setPropertyValue("Filename", filename);
+    TS_ASSERT_THROWS_NOTHING(save->execute());
+
+    auto load = AlgorithmManager::Instance().create("LoadNexusProcessed");
+    load->initialize();
+    load->setPropertyValue("Filename", filename);
+    load->setPropertyValue("OutputWorkspace", "output");
+    TS_ASSERT_THROWS_NOTHING(load->execute());
+
+    MatrixWorkspace_sptr outputWs =
+        AnalysisDataService::Instance().retrieveWS<MatrixWorkspace>("output");
+    for (size_t i = 0; i < 5; ++i) {
+      TS_ASSERT_EQUALS(inputWs->x(i), outputWs->x(i));
+      TS_ASSERT_EQUALS(inputWs->y(i), outputWs->y(i));
+    }
+    TS_ASSERT_EQUALS(&outputWs->x(0), &outputWs->x(1));
+    TS_ASSERT_EQUALS(&outputWs->x(0), &outputWs->x(2));
+    TS_ASSERT_DIFFERS(&outputWs->x(2), &outputWs->x(3));
+    TS_ASSERT_EQUALS(&outputWs->x(3), &outputWs->x(4));
+
+    AnalysisDataService::Instance().remove("output");
+    Poco::File(save->getPropertyValue("Filename")).remove();
+  }
+
   void test_that_workspace_name_is_loaded() {
     // Arrange
     LoadNexusProcessed loader;
@@ -291,6 +291,38 @@ public:
     AnalysisDataService::Instance().remove(outWS);
   }
 
+  void test_spectrum_list_matches_full_load_and_shares_bins() {
+    LoadRaw3 loadAll;
+    loadAll.initialize();
+    loadAll.setPropertyValue("Filename", inputFile);
+    loadAll.setPropertyValue("OutputWorkspace", "allSpectra");
+    TS_ASSERT(loadAll.execute());
+    LoadRaw3 loadList;
+    loadList.initialize();
+    loadList.setPropertyValue("Filename", inputFile);
+    loadList.setPropertyValue("OutputWorkspace", "listedSpectra");
+    loadList.setPropertyValue("SpectrumList", "2,1000,2584");
+    TS_ASSERT(loadList.execute());
+
+    auto &ads = AnalysisDataService::Instance();
+    auto all = ads.retrieveWS<Workspace2D>("allSpectra");
+    auto listed = ads.retrieveWS<Workspace2D>("listedSpectra");
+    TS_ASSERT_EQUALS(listed->getNumberHistograms(), 3);
+    const std::vector<size_t> indices{1, 999, 2583};
+    for (size_t i = 0; i < indices.size(); ++i) {
+      TS_ASSERT_EQUALS(listed->getSpectrum(i).getSpectrumNo(),
+                       all->getSpectrum(indices[i]).getSpectrumNo());
+      TS_ASSERT_EQUALS(listed->y(i).rawData(), all->y(indices[i]).rawData());
+      TS_ASSERT_EQUALS(listed->e(i).rawData(), all->e(indices[i]).rawData());
+    }
+    // Every spectrum uses the same time channels
+    for (size_t i = 1; i < all->getNumberHistograms(); ++i)
+      TS_ASSERT_EQUALS(&all->x(i), &all->x(0));
+    TS_ASSERT_EQUALS(&listed->x(2), &listed->x(0));
+    ads.remove("allSpectra");
+    ads.remove("listedSpectra");
+  }
+
   void testfail() {
     LoadRaw3 loader3;
     if (!loader3.isInitialized())
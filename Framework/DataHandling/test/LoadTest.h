@@ -9,8 +9,10 @@
 #include "MantidAPI/AlgorithmManager.h"
 #include "MantidAPI/AnalysisDataService.h"
 #include "MantidAPI/MatrixWorkspace.h"
+#include "MantidAPI/Run.h"
 #include "MantidAPI/WorkspaceGroup.h"
 #include "MantidDataHandling/Load.h"
+#include "MantidDataObjects/EventWorkspace.h"
 #include "MantidDataObjects/Workspace2D.h"
 #include "MantidKernel/ConfigService.h"
 #include <cxxtest/TestSuite.h>
@@ -309,6 +311,68 @@ public:
     TS_ASSERT_EQUALS(output2D->getNumberHistograms(), 397);
   }
 
+  void test_summing_event_runs_appends_events_and_merges_logs() {
+    Load single;
+    single.initialize();
+    single.setPropertyValue("Filename", "CNCS_7860_event.nxs");
+    single.setPropertyValue("OutputWorkspace", "single");
+    TS_ASSERT_THROWS_NOTHING(single.execute());
+
+    Load summed;
+    summed.initialize();
+    summed.setPropertyValue("Filename",
+                            "CNCS_7860_event.nxs+CNCS_7860_event.nxs");
+    summed.setPropertyValue("OutputWorkspace", "summed");
+    TS_ASSERT_THROWS_NOTHING(summed.execute());
+
+    auto &ads = AnalysisDataService::Instance();
+    auto one = ads.retrieveWS<EventWorkspace>("single");
+    auto two = ads.retrieveWS<EventWorkspace>("summed");
+    TS_ASSERT(two);
+    if (!one || !two)
+      return;
+    TS_ASSERT_EQUALS(two->getNumberHistograms(), one->getNumberHistograms());
+    TS_ASSERT_EQUALS(two->getNumberEvents(), 2 * one->getNumberEvents());
+    TS_ASSERT_EQUALS(two->getSpectrum(0).getNumberEvents(),
+                     2 * one->getSpectrum(0).getNumberEvents());
+    TS_ASSERT_DELTA(two->run().getProtonCharge(),
+                    2 * one->run().getProtonCharge(), 1e-8);
+    // Only the summed run is left in the ADS
+    TS_ASSERT_EQUALS(ads.size(), 2);
+  }
+
+  void test_summing_runs_concurrently_matches_serial_sum() {
+    const std::string files = "HET15869.raw+HET15869.raw+HET15869.raw";
+    Load single;
+    single.initialize();
+    single.setPropertyValue("Filename", "HET15869.raw");
+    single.setPropertyValue("SpectrumMax", "10");
+    single.setPropertyValue("OutputWorkspace", "single");
+    TS_ASSERT_THROWS_NOTHING(single.execute());
+
+    for (const auto &maxLoads : {"1", "3"}) {
+      Load summed;
+      summed.initialize();
+      summed.setPropertyValue("Filename", files);
+      summed.setPropertyValue("SpectrumMax", "10");
+      summed.setPropertyValue("MaxConcurrentLoads", maxLoads);
+      summed.setPropertyValue("OutputWorkspace", "summed");
+      TS_ASSERT_THROWS_NOTHING(summed.execute());
+
+      auto &ads = AnalysisDataService::Instance();
+      auto one = ads.retrieveWS<MatrixWorkspace>("single");
+      auto three = ads.retrieveWS<MatrixWorkspace>("summed");
+      TS_ASSERT_EQUALS(three->getNumberHistograms(), 10);
+      for (size_t i = 0; i < three->getNumberHistograms(); ++i) {
+        const auto &y1 = one->y(i);
+        const auto &y3 = three->y(i);
+        TS_ASSERT_EQUALS(y3.size(), y1.size());
+        for (size_t j = 0; j < y1.size(); ++j)
+          TS_ASSERT_DELTA(y3[j], 3 * y1[j], 1e-10);
+      }
+    }
+  }
+
   void test_EventPreNeXus_WithNoExecute() {
     Load loader;
     loader.initialize();
@@ -0,0 +1,455 @@
+// Mantid Repository : https://github.com/mantidproject/mantid
+//
+// Copyright &copy; 2020 ISIS Rutherford Appleton Laboratory UKRI,
+//   NScD Oak Ridge National Laboratory, European Spallation Source,
+//   Institut Laue - Langevin & CSNS, Institute of High Energy Physics, CAS
+// SPDX - License - Identifier: GPL - 3.0 +
+#pragma once
+
+#include "MantidAPI/AlgorithmManager.h"
+#include "MantidAPI/FileFinder.h"
+#include "MantidAPI/FrameworkManager.h"
+#include "MantidAPI/MatrixWorkspace.h"
+#include "MantidAPI/Run.h"
+#include "MantidDataObjects/EventWorkspace.h"
+#include "MantidDataObjects/Workspace2D.h"
+#include "MantidKernel/Memory.h"
+#include "MantidKernel/NexusHDF5Descriptor.h"
+#include "MantidKernel/Timer.h"
+#include "MantidTestHelpers/FileResource.h"
+#include "MantidTestHelpers/WorkspaceCreationHelper.h"
+
+#include <cxxtest/TestSuite.h>
+#include <nexus/NeXusFile.hpp>
+
+#include <Poco/File.h>
+
+#include <algorithm>
+#include <cstdlib>
+#include <fstream>
+#include <functional>
+#include <iostream>
+#include <sstream>
+
+using namespace Mantid::API;
+using Mantid::DataObjects::EventWorkspace_sptr;
+using Mantid::Kernel::NexusHDF5Descriptor;
+
+/* Benchmarks of the DataHandling loaders on synthetic files.
+
+  The LoaderBenchmarkTestPerformance suite writes files of a size set by the
+  environment variables below, then times walking each file and loading it.
+  The results are written as one JSON object per loader, one per line, to the
+  file named by MANTID_LOADER_BENCHMARK_OUTPUT, or to the standard output.
+
+    MANTID_LOADER_BENCHMARK_EVENTS   events in the event files (2000000)
+    MANTID_LOADER_BENCHMARK_BANKS    banks of the event NeXus file, at most
+                                     the 50 of CNCS (10)
+    MANTID_LOADER_BENCHMARK_LOGS     time series logs of the NeXus files (100)
+    MANTID_LOADER_BENCHMARK_VALUES   values in each log (1000)
+    MANTID_LOADER_BENCHMARK_SPECTRA  spectra of the processed histograms,
+                                     each of 1000 bins (5000)
+
+  There is no writer for RAW files, so LoadRaw3 reads the HET15869.raw
+  reference file and LoadISISNexus2 the result of SaveISISNexus on it.
+*/
+namespace {
+/// Start of the synthetic runs
+constexpr const char *START_TIME = "2010-03-25T16:08:37";
+/// End of the synthetic runs
+constexpr const char *END_TIME = "2010-03-25T16:11:51";
+/// Number of pulses in the synthetic event files, a minute at 60 Hz
+constexpr size_t NUMBER_OF_PULSES = 3600;
+/// Number of pixels in each bank of CNCS
+constexpr size_t PIXELS_PER_BANK = 1024;
+/// Number of banks of CNCS
+constexpr size_t MAXIMUM_NUMBER_OF_BANKS = 50;
+
+/// The size given by an environment variable, or the default if it is unset
+size_t sizeFromEnvironment(const char *variable, const size_t defaultSize) {
+  const char *value = std::getenv(variable);
+  if (!value)
+    return defaultSize;
+  try {
+    return std::stoull(value);
+  } catch (std::exception &) {
+    std::cerr << "Ignoring invalid " << variable << "=" << value << "\n";
+    return defaultSize;
+  }
+}
+
+/// The measurements of one benchmarked load
+struct BenchmarkResult {
+  std::string loader;
+  uint64_t fileBytes{0};
+  uint64_t events{0};
+  uint64_t spectra{0};
+  uint64_t logs{0};
+  /// Wall clock time of each phase in seconds, in the order they were run
+  std::vector<std::pair<std::string, double>> phases;
+  /// Peak resident set size of the process after loading, in bytes
+  size_t peakRSS{0};
+
+  double seconds(const std::string &phase) const {
+    for (const auto &timing : phases)
+      if (timing.first == phase)
+        return timing.second;
+    return 0.;
+  }
+
+  std::string toJson() const {
+    const double loadSeconds = seconds("load");
+    std::ostringstream json;
+    json << R"({"loader":")" << loader << R"(","file_bytes":)" << fileBytes
+         << R"(,"events":)" << events << R"(,"spectra":)" << spectra
+         << R"(,"logs":)" << logs << R"(,"phases":{)";
+    for (size_t i = 0; i < phases.size(); ++i)
+      json << (i > 0 ? "," : "") << '"' << phases[i].first
+           << "\":" << phases[i].second;
+    json << R"(},"mb_per_s":)"
+         << (loadSeconds > 0.
+                 ? 1e-6 * static_cast<double>(fileBytes) / loadSeconds
+                 : 0.)
+         << R"(,"events_per_s":)"
+         << (loadSeconds > 0. ? static_cast<double>(events) / loadSeconds
+                              : 0.)
+         << R"(,"peak_rss_bytes":)" << peakRSS << '}';
+    return json.str();
+  }
+};
+
+/// Time a phase of a benchmark
+void timePhase(BenchmarkResult &result, const std::string &phase,
+               const std::function<void()> &run) {
+  Mantid::Kernel::Timer timer;
+  run();
+  result.phases.emplace_back(phase, timer.elapsed());
+}
+
+/** Time walking a file, as every NeXus HDF5 loader does first, then running a
+ * loader on it. The cache of walked files is cleared first so that the walk
+ * is timed on its own and not again within the load.
+ */
+void timeLoad(BenchmarkResult &result, IAlgorithm &loader,
+              const std::string &filename, const bool isHDF5) {
+  if (isHDF5) {
+    NexusHDF5Descriptor::clearCache();
+    timePhase(result, "describe",
+              [&filename]() { NexusHDF5Descriptor descriptor(filename); });
+  }
+  timePhase(result, "load", [&loader]() { loader.execute(); });
+  result.fileBytes = Poco::File(filename).getSize();
+  result.peakRSS = Mantid::Kernel::MemoryStats().getPeakRSS();
+}
+
+/// Write the result to the output file of the benchmarks, or print it
+void report(const BenchmarkResult &result) {
+  const char *output = std::getenv("MANTID_LOADER_BENCHMARK_OUTPUT");
+  if (output) {
+    std::ofstream file(output, std::ios::app);
+    file << result.toJson() << "\n";
+  } else {
+    std::cout << "\n" << result.toJson() << "\n";
+  }
+}
+
+/// Write a field holding an array with a string attribute
+template <typename T>
+void writeWithAttribute(::NeXus::File &file, const std::string &name,
+                        const std::vector<T> &values, const char *attribute,
+                        const char *attributeValue) {
+  file.writeData(name, values);
+  file.openData(name);
+  file.putAttr(attribute, attributeValue);
+  file.closeData();
+}
+
+/// Write NXlogs of double values to a DASlogs collection
+void writeLogs(::NeXus::File &file, const size_t numberOfLogs,
+               const size_t valuesPerLog) {
+  file.makeGroup("DASlogs", "NXcollection", true);
+  std::vector<double> times(valuesPerLog);
+  std::vector<double> values(valuesPerLog);
+  for (size_t i = 0; i < valuesPerLog; ++i)
+    times[i] = 0.01 * static_cast<double>(i);
+  for (size_t log = 0; log < numberOfLogs; ++log) {
+    for (size_t i = 0; i < valuesPerLog; ++i)
+      values[i] = static_cast<double>(log) + 1e-3 * static_cast<double>(i);
+    file.makeGroup("Log" + std::to_string(log), "NXlog", true);
+    writeWithAttribute(file, "time", times, "start", START_TIME);
+    writeWithAttribute(file, "value", values, "units", "K");
+    file.closeGroup();
+  }
+  file.closeGroup();
+}
+
+/** Write an event NeXus file for CNCS, with the events shared evenly between
+ * the banks and the pulses, and a DASlogs collection.
+ */
+void writeEventFile(const std::string &filename, const size_t numberOfEvents,
+                    size_t numberOfBanks, const size_t numberOfLogs,
+                    const size_t valuesPerLog) {
+  numberOfBanks =
+      std::max<size_t>(1, std::min(numberOfBanks, MAXIMUM_NUMBER_OF_BANKS));
+  const size_t eventsPerBank =
+      std::max<size_t>(1, numberOfEvents / numberOfBanks);
+
+  ::NeXus::File file(filename, NXACC_CREATE5);
+  file.makeGroup("entry", "NXentry", true);
+  file.writeData("start_time", START_TIME);
+  file.writeData("end_time", END_TIME);
+  file.makeGroup("instrument", "NXinstrument", true);
+  file.writeData("name", "CNCS");
+  file.closeGroup();
+
+  std::vector<double> pulseTimes(NUMBER_OF_PULSES);
+  std::vector<uint64_t> eventIndex(NUMBER_OF_PULSES);
+  for (size_t pulse = 0; pulse < NUMBER_OF_PULSES; ++pulse) {
+    pulseTimes[pulse] = static_cast<double>(pulse) / 60.;
+    eventIndex[pulse] = pulse * eventsPerBank / NUMBER_OF_PULSES;
+  }
+  std::vector<uint32_t> ids(eventsPerBank);
+  std::vector<float> tofs(eventsPerBank);
+  for (size_t bank = 0; bank < numberOfBanks; ++bank) {
+    for (size_t i = 0; i < eventsPerBank; ++i) {
+      // Spread the events over the pixels and times of flight
+      ids[i] = static_cast<uint32_t>(bank * PIXELS_PER_BANK +
+                                     (i * 7919) % PIXELS_PER_BANK);
+      tofs[i] = 1000.f + static_cast<float>((i * 104729) % 40000);
+    }
+    file.makeGroup("bank" + std::to_string(bank + 1) + "_events",
+                   "NXevent_data", true);
+    file.writeData("event_id", ids);
+    writeWithAttribute(file, "event_time_offset", tofs, "units",
+                       "microsecond");
+    file.writeData("event_time_zero", pulseTimes);
+    file.openData("event_time_zero");
+    file.putAttr("offset", START_TIME);
+    file.putAttr("units", "second");
+    file.closeData();
+    file.writeData("event_index", eventIndex);
+    file.writeData("total_counts", static_cast<uint64_t>(eventsPerBank));
+    file.closeGroup();
+  }
+  writeLogs(file, numberOfLogs, valuesPerLog);
+  file.closeGroup();
+  file.close();
+}
+
+/// Write an entry holding only logs, as read by LoadNexusLogs
+void writeLogFile(const std::string &filename, const size_t numberOfLogs,
+                  const size_t valuesPerLog) {
+  ::NeXus::File file(filename, NXACC_CREATE5);
+  file.makeGroup("entry", "NXentry", true);
+  file.writeData("start_time", START_TIME);
+  file.writeData("end_time", END_TIME);
+  writeLogs(file, numberOfLogs, valuesPerLog);
+  file.closeGroup();
+  file.close();
+}
+
+/// Save a workspace with SaveNexusProcessed
+void saveProcessed(const Workspace_sptr &workspace,
+                   const std::string &filename) {
+  auto saver = AlgorithmManager::Instance().createUnmanaged(
+      "SaveNexusProcessed");
+  saver->initialize();
+  saver->setChild(true);
+  saver->setProperty("InputWorkspace", workspace);
+  saver->setPropertyValue("Filename", filename);
+  saver->execute();
+}
+
+std::shared_ptr<IAlgorithm> createLoader(const std::string &name,
+                                         const std::string &filename) {
+  auto loader = AlgorithmManager::Instance().createUnmanaged(name);
+  loader->initialize();
+  loader->setChild(true);
+  loader->setPropertyValue("Filename", filename);
+  if (loader->existsProperty("OutputWorkspace"))
+    loader->setPropertyValue("OutputWorkspace", "benchmark");
+  return loader;
+}
+
+BenchmarkResult benchmarkLoadEventNexus(const size_t numberOfEvents,
+                                        const size_t numberOfBanks,
+                                        const size_t numberOfLogs,
+                                        const size_t valuesPerLog) {
+  FileResource file("LoaderBenchmarkEvents.nxs.h5");
+  BenchmarkResult result;
+  result.loader = "LoadEventNexus";
+  timePhase(result, "write", [&]() {
+    writeEventFile(file.fullPath(), numberOfEvents, numberOfBanks,
+                   numberOfLogs, valuesPerLog);
+  });
+  auto loader = createLoader("LoadEventNexus", file.fullPath());
+  timeLoad(result, *loader, file.fullPath(), true);
+  EventWorkspace_sptr workspace = loader->getProperty("OutputWorkspace");
+  result.events = workspace->getNumberEvents();
+  result.spectra = workspace->getNumberHistograms();
+  result.logs = workspace->run().getLogData().size();
+  return result;
+}
+
+BenchmarkResult benchmarkLoadNexusProcessed(const Workspace_sptr &input) {
+  FileResource file("LoaderBenchmarkProcessed.nxs");
+  BenchmarkResult result;
+  result.loader = "LoadNexusProcessed";
+  timePhase(result, "write",
+            [&]() { saveProcessed(input, file.fullPath()); });
+  auto loader = createLoader("LoadNexusProcessed", file.fullPath());
+  timeLoad(result, *loader, file.fullPath(), true);
+  Workspace_sptr output = loader->getProperty("OutputWorkspace");
+  const auto workspace = std::dynamic_pointer_cast<MatrixWorkspace>(output);
+  result.spectra = workspace->getNumberHistograms();
+  if (const auto events =
+          std::dynamic_pointer_cast<Mantid::DataObjects::EventWorkspace>(
+              workspace))
+    result.events = events->getNumberEvents();
+  return result;
+}
+
+BenchmarkResult benchmarkLoadNexusLogs(const size_t numberOfLogs,
+                                       const size_t valuesPerLog) {
+  FileResource file("LoaderBenchmarkLogs.nxs.h5");
+  BenchmarkResult result;
+  result.loader = "LoadNexusLogs";
+  timePhase(result, "write", [&]() {
+    writeLogFile(file.fullPath(), numberOfLogs, valuesPerLog);
+  });
+  auto loader = createLoader("LoadNexusLogs", file.fullPath());
+  MatrixWorkspace_sptr workspace =
+      WorkspaceCreationHelper::create2DWorkspace(1, 1);
+  loader->setProperty("Workspace", workspace);
+  timeLoad(result, *loader, file.fullPath(), true);
+  result.logs = workspace->run().getLogData().size();
+  return result;
+}
+
+BenchmarkResult benchmarkLoadRaw() {
+  const auto filename = FileFinder::Instance().getFullPath("HET15869.raw");
+  BenchmarkResult result;
+  result.loader = "LoadRaw";
+  auto loader = createLoader("LoadRaw", filename);
+  timeLoad(result, *loader, filename, false);
+  Workspace_sptr output = loader->getProperty("OutputWorkspace");
+  result.spectra =
+      std::dynamic_pointer_cast<MatrixWorkspace>(output)->getNumberHistograms();
+  return result;
+}
+
+BenchmarkResult benchmarkLoadISISNexus() {
+  FileResource file("LoaderBenchmarkISIS.nxs");
+  BenchmarkResult result;
+  result.loader = "LoadISISNexus";
+  timePhase(result, "write", [&]() {
+    auto saver =
+        AlgorithmManager::Instance().createUnmanaged("SaveISISNexus");
+    saver->initialize();
+    saver->setChild(true);
+    saver->setPropertyValue("InputFilename", "HET15869.raw");
+    saver->setPropertyValue("OutputFilename", file.fullPath());
+    saver->execute();
+  });
+  auto loader = createLoader("LoadISISNexus", file.fullPath());
+  timeLoad(result, *loader, file.fullPath(), true);
+  Workspace_sptr output = loader->getProperty("OutputWorkspace");
+  result.spectra =
+      std::dynamic_pointer_cast<MatrixWorkspace>(output)->getNumberHistograms();
+  return result;
+}
+} // namespace
+
+class LoaderBenchmarkTest : public CxxTest::TestSuite {
+public:
+  // This pair of boilerplate methods prevent the suite being created statically
+  // This means the constructor isn't called when running other tests
+  static LoaderBenchmarkTest *createSuite() {
+    return new LoaderBenchmarkTest();
+  }
+  static void destroySuite(LoaderBenchmarkTest *suite) { delete suite; }
+
+  LoaderBenchmarkTest() { FrameworkManager::Instance(); }
+
+  void test_synthetic_event_file_loads_every_event() {
+    const auto result = benchmarkLoadEventNexus(10000, 4, 3, 20);
+    TS_ASSERT_EQUALS(result.events, 10000);
+    TS_ASSERT_EQUALS(result.spectra, 51200);
+    TS_ASSERT_LESS_THAN(3, result.logs);
+    TS_ASSERT_LESS_THAN(0, result.fileBytes);
+    TS_ASSERT_EQUALS(result.phases.size(), 3);
+  }
+
+  void test_synthetic_log_file_loads_every_log() {
+    const auto result = benchmarkLoadNexusLogs(5, 10);
+    TS_ASSERT_LESS_THAN_EQUALS(5, result.logs);
+    TS_ASSERT_EQUALS(result.events, 0);
+  }
+
+  void test_result_is_reported_as_json() {
+    BenchmarkResult result;
+    result.loader = "Load";
+    result.fileBytes = 2000000;
+    result.events = 10;
+    result.phases = {{"describe", 0.5}, {"load", 2.}};
+    result.peakRSS = 1024;
+    TS_ASSERT_EQUALS(result.toJson(),
+                     R"({"loader":"Load","file_bytes":2000000,"events":10,)"
+                     R"("spectra":0,"logs":0,"phases":{"describe":0.5,)"
+                     R"("load":2},"mb_per_s":1,"events_per_s":5,)"
+                     R"("peak_rss_bytes":1024})");
+  }
+};
+
+class LoaderBenchmarkTestPerformance : public CxxTest::TestSuite {
+public:
+  static LoaderBenchmarkTestPerformance *createSuite() {
+    return new LoaderBenchmarkTestPerformance();
+  }
+  static void destroySuite(LoaderBenchmarkTestPerformance *suite) {
+    delete suite;
+  }
+
+  LoaderBenchmarkTestPerformance()
+      : m_events(
+            sizeFromEnvironment("MANTID_LOADER_BENCHMARK_EVENTS", 2000000)),
+        m_banks(sizeFromEnvironment("MANTID_LOADER_BENCHMARK_BANKS", 10)),
+        m_logs(sizeFromEnvironment("MANTID_LOADER_BENCHMARK_LOGS", 100)),
+        m_values(sizeFromEnvironment("MANTID_LOADER_BENCHMARK_VALUES", 1000)),
+        m_spectra(
+            sizeFromEnvironment("MANTID_LOADER_BENCHMARK_SPECTRA", 5000)) {
+    FrameworkManager::Instance();
+  }
+
+  void test_LoadEventNexus() {
+    report(benchmarkLoadEventNexus(m_events, m_banks, m_logs, m_values));
+  }
+
+  void test_LoadNexusProcessed_histograms() {
+    report(benchmarkLoadNexusProcessed(
+        WorkspaceCreationHelper::create2DWorkspaceBinned(m_spectra, 1000)));
+  }
+
+  void test_LoadNexusProcessed_events() {
+    // Spread the events over a thousand spectra
+    const auto eventsPerSpectrum = static_cast<int>(m_events / 1000);
+    report(benchmarkLoadNexusProcessed(
+        WorkspaceCreationHelper::createEventWorkspace(1000, 1000,
+                                                      eventsPerSpectrum)));
+  }
+
+  void test_LoadNexusLogs() {
+    report(benchmarkLoadNexusLogs(m_logs, m_values));
+  }
+
+  void test_LoadRaw() { report(benchmarkLoadRaw()); }
+
+  void test_LoadISISNexus() { report(benchmarkLoadISISNexus()); }
+
+private:
+  const size_t m_events;
+  const size_t m_banks;
+  const size_t m_logs;
+  const size_t m_values;
+  const size_t m_spectra;
+};
@@ -223,13 +223,15 @@ public:
    * @param clearfiles :: clear files after saving
    * @param PreserveEvents :: save as event list
    * @param CompressNexus :: compress
+   * @param EventBlockSize :: number of events written at a time
    * @return
    */
   static EventWorkspace_sptr
   do_testExec_EventWorkspaces(const std::string &filename_root, EventType type,
                               std::string &outputFile, bool makeDifferentTypes,
                               bool clearfiles, bool PreserveEvents = true,
-                              bool CompressNexus = false) {
+                              bool CompressNexus = false,
+                              int EventBlockSize = 1 << 20) {
     std::vector<std::vector<int>> groups(5);
     groups[0].emplace_back(10);
     groups[0].emplace_back(11);
@@ -273,6 +275,7 @@ public:
     alg.setPropertyValue("Title", title);
     alg.setProperty("PreserveEvents", PreserveEvents);
     alg.setProperty("CompressNexus", CompressNexus);
+    alg.setProperty("EventBlockSize", EventBlockSize);
 
     // Clear the existing file, if any
     if (Poco::File(outputFile).exists())
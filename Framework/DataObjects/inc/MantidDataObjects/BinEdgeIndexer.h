@@ -0,0 +1,69 @@
+// Mantid Repository : https://github.com/mantidproject/mantid
+//
+// Copyright &copy; 2020 ISIS Rutherford Appleton Laboratory UKRI,
+//   NScD Oak Ridge National Laboratory, European Spallation Source,
+//   Institut Laue - Langevin & CSNS, Institute of High Energy Physics, CAS
+// SPDX - License - Identifier: GPL - 3.0 +
+#pragma once
+
+#include "MantidKernel/System.h"
+
+#include <cstddef>
+#include <limits>
+#include <vector>
+
+namespace Mantid {
+namespace DataObjects {
+
+/** BinEdgeIndexer : Finds the bin that a value falls in for a set of bin
+  edges, using the convention of EventList::generateHistogram(): value x is in
+  bin i if edges[i] <= x < edges[i+1].
+
+  Linear (constant width) and logarithmic (constant ratio) edges, such as those
+  produced by Rebin, are detected on construction. For these the index is
+  computed in closed form, in blocks that the compiler can vectorize, and then
+  corrected against the real edges so that rounding can never move a value
+  into a neighbouring bin. Arbitrary edges fall back to a binary search.
+
+  A closed-form index does not depend on the order of the values, so callers
+  can histogram an unsorted event list without sorting it first.
+*/
+class DLLExport BinEdgeIndexer {
+public:
+  /// How the bin edges are spaced
+  enum class Spacing { Linear, Logarithmic, Arbitrary };
+
+  /// Index returned for values outside of the bin edges
+  static constexpr std::size_t npos = std::numeric_limits<std::size_t>::max();
+
+  explicit BinEdgeIndexer(const std::vector<double> &edges);
+
+  /// @return how the bin edges are spaced
+  Spacing spacing() const { return m_spacing; }
+  /// @return true if bin indices are computed in closed form
+  bool isClosedForm() const { return m_spacing != Spacing::Arbitrary; }
+  /// @return the number of bins (one fewer than the number of edges)
+  std::size_t numberOfBins() const { return m_numBins; }
+
+  std::size_t index(const double x) const;
+  void indices(const double *values, const std::size_t count,
+               std::size_t *out) const;
+
+private:
+  void detectSpacing();
+  std::size_t correct(const double x, double guess) const;
+
+  /// The bin edges
+  const std::vector<double> &m_edges;
+  /// Number of bins
+  std::size_t m_numBins;
+  /// Type of spacing found
+  Spacing m_spacing;
+  /// Lowest edge, or the log of it for logarithmic spacing
+  double m_origin;
+  /// Reciprocal of the bin width, or of the log of the ratio
+  double m_inverseStep;
+};
+
+} // namespace DataObjects
+} // namespace Mantid
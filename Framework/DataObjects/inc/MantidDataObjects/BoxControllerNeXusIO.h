@@ -11,7 +11,10 @@
 #include "MantidKernel/DiskBuffer.h"
 #include <nexus/NeXusFile.hpp>
 
+#include <future>
+#include <list>
 #include <mutex>
+#include <unordered_map>
 
 namespace Mantid {
 namespace DataObjects {
@@ -21,10 +24,32 @@ namespace DataObjects {
   controller interface
   * Expected to provide thread-safe file access.
 
+    Reads are served from a cache of large pages of consecutive events. Once
+  the pages are read in order, the pages which follow are read in the
+  background, so boxes visited in file order rarely wait for the file.
+
     @date March 15, 2013
 */
 class DLLExport BoxControllerNeXusIO : public API::IBoxControllerIO {
 public:
+  /// Counters describing how well the page cache served the reads
+  struct PageCacheStatistics {
+    /// reads of a page found in memory or already being read ahead
+    uint64_t hits = 0;
+    /// reads of a page which had to be read from the file there and then
+    uint64_t misses = 0;
+    /// pages read from the file, including those read ahead
+    uint64_t pagesRead = 0;
+    /// bytes read from the file
+    uint64_t bytesRead = 0;
+    /// time, in seconds, readers spent waiting for the file
+    double ioWaitSeconds = 0.;
+    /// the fraction of page reads served without going to the file
+    double hitRate() const {
+      return hits + misses == 0 ? 0. : double(hits) / double(hits + misses);
+    }
+  };
+
   BoxControllerNeXusIO(API::BoxController *const bc);
 
   ///@return true if the file to write events is opened and false otherwise
@@ -62,6 +87,10 @@ public:
   // get pointer to the Nexus file --> compatribility testing only.
   ::NeXus::File *getFile() { return m_File.get(); }
 
+  void setPageCache(const size_t pageEvents, const uint64_t memoryBudget,
+                    const size_t readAheadPages);
+  PageCacheStatistics getPageCacheStatistics() const;
+
 private:
   /// Default size of the events block which can be written in the NeXus array
   /// at once identified by efficiency or some other external reasons
@@ -145,6 +174,54 @@ private:
   template <typename Type>
   void loadGenericBlock(std::vector<Type> &Block, const uint64_t blockPosition,
                         const size_t nPoints) const;
+
+  /// A run of consecutive events, stored as they are in the file
+  struct Page {
+    std::vector<char> data;
+    uint64_t numEvents;
+  };
+  using PagePtr = std::shared_ptr<const Page>;
+  /// A cached page and its place in the least recently used order
+  struct CachedPage {
+    PagePtr page;
+    std::list<uint64_t>::iterator order;
+  };
+
+  PagePtr fetchPage(const uint64_t pageIndex) const;
+  std::vector<std::promise<PagePtr>>
+  reservePages(const uint64_t pageIndex) const;
+  std::vector<PagePtr> readPages(const uint64_t firstPage,
+                                 const size_t numPages) const;
+  void readInto(const uint64_t firstPage,
+                std::vector<std::promise<PagePtr>> &promises,
+                const uint64_t generation) const;
+  void cachePage(const uint64_t pageIndex, PagePtr page) const;
+  void invalidatePages(const uint64_t firstEvent,
+                       const uint64_t numEvents) const;
+  void clearPageCache();
+
+  /// the number of events in a page, zero if the cache is disabled
+  size_t m_pageEvents;
+  /// the number of bytes the cached pages may take up
+  uint64_t m_memoryBudget;
+  /// the number of pages read after a page missing from the cache
+  size_t m_readAheadPages;
+  /// the number of bytes in one value stored in the file
+  size_t m_fileValueSize;
+  /// guards the page cache, the pages in flight and the statistics
+  mutable std::mutex m_pageMutex;
+  /// the cached pages by index
+  mutable std::unordered_map<uint64_t, CachedPage> m_pages;
+  /// the cached page indices, most recently used first
+  mutable std::list<uint64_t> m_pageOrder;
+  /// the bytes held by the cached pages
+  mutable uint64_t m_cachedBytes;
+  /// pages being read by another reader, which readers can wait for
+  mutable std::unordered_map<uint64_t, std::shared_future<PagePtr>>
+      m_pagesInFlight;
+  /// bumped on every write, so that stale pages read before it are dropped
+  mutable uint64_t m_cacheGeneration;
+  mutable PageCacheStatistics m_statistics;
 };
 } // namespace DataObjects
 } // namespace Mantid
\ No newline at end of file
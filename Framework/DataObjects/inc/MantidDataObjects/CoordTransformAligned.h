@@ -51,6 +51,15 @@ public:
   void apply(const coord_t *inputVector, coord_t *outVector) const override;
   Mantid::Kernel::Matrix<coord_t> makeAffineMatrix() const override;
 
+  /// @return the input dimension each output dimension is binned from
+  const std::vector<size_t> &getDimensionToBinFrom() const {
+    return m_dimensionToBinFrom;
+  }
+  /// @return the origin of each output dimension
+  const std::vector<coord_t> &getOrigin() const { return m_origin; }
+  /// @return the scaling of each output dimension
+  const std::vector<coord_t> &getScaling() const { return m_scaling; }
+
 protected:
   /// For each dimension in the output, index in the input workspace of which
   /// dimension it is
@@ -26,6 +26,7 @@ using TimeSplitterType = std::vector<SplittingInterval>;
 class Unit;
 } // namespace Kernel
 namespace DataObjects {
+class BinEdgeIndexer;
 class EventWorkspaceMRU;
 
 /// How the event list is sorted.
@@ -148,9 +149,13 @@ public:
 
   void setMRU(EventWorkspaceMRU *newMRU);
 
+  void addToCachedHistogram(const EventList &more_events,
+                            const bool subtract) const;
+
   void clearData() override;
 
   void reserve(size_t num) override;
+  size_t capacity() const;
 
   void sort(const EventSortType order) const;
 
@@ -293,16 +298,17 @@ public:
                    std::vector<EventList *> outputs) const;
 
   void splitByFullTime(Kernel::TimeSplitterType &splitter,
-                       std::map<int, EventList *> outputs, bool docorrection,
-                       double toffactor, double tofshift) const;
+                       const std::map<int, EventList *> &outputs,
+                       bool docorrection, double toffactor,
+                       double tofshift) const;
 
   /// Split ...
   std::string
-  splitByFullTimeMatrixSplitter(const std::vector<int64_t> &vec_splitters_time,
-                                const std::vector<int> &vecgroups,
-                                std::map<int, EventList *> vec_outputEventList,
-                                bool docorrection, double toffactor,
-                                double tofshift) const;
+  splitByFullTimeMatrixSplitter(
+      const std::vector<int64_t> &vec_splitters_time,
+      const std::vector<int> &vecgroups,
+      const std::map<int, EventList *> &vec_outputEventList, bool docorrection,
+      double toffactor, double tofshift) const;
 
   /// Split events by pulse time
   void splitByPulseTime(Kernel::TimeSplitterType &splitter,
@@ -438,6 +444,9 @@ private:
   static void histogramForWeightsHelper(const std::vector<T> &events,
                                         const MantidVec &X, MantidVec &Y,
                                         MantidVec &E);
+  static void
+  countsByIndexHelper(const std::vector<Types::Event::TofEvent> &events,
+                      const BinEdgeIndexer &indexer, MantidVec &Y);
   template <class T>
   static void integrateHelper(std::vector<T> &events, const double minX,
                               const double maxX, const bool entireRange,
@@ -500,8 +509,8 @@ private:
                          typename std::vector<T> &events) const;
   template <class T>
   void splitByFullTimeHelper(Kernel::TimeSplitterType &splitter,
-                             std::map<int, EventList *> outputs,
-                             typename std::vector<T> &events, bool docorrection,
+                             const std::map<int, EventList *> &outputs,
+                             const std::vector<T> &events, bool docorrection,
                              double toffactor, double tofshift) const;
   /// Split events by pulse time
   template <class T>
@@ -520,14 +529,16 @@ private:
   template <class T>
   std::string splitByFullTimeVectorSplitterHelper(
       const std::vector<int64_t> &vectimes, const std::vector<int> &vecgroups,
-      std::map<int, EventList *> outputs, typename std::vector<T> &vecEvents,
-      bool docorrection, double toffactor, double tofshift) const;
+      const std::map<int, EventList *> &outputs,
+      const std::vector<T> &vecEvents, bool docorrection, double toffactor,
+      double tofshift) const;
 
   template <class T>
   std::string splitByFullTimeSparseVectorSplitterHelper(
       const std::vector<int64_t> &vectimes, const std::vector<int> &vecgroups,
-      std::map<int, EventList *> outputs, typename std::vector<T> &vecEvents,
-      bool docorrection, double toffactor, double tofshift) const;
+      const std::map<int, EventList *> &outputs,
+      const std::vector<T> &vecEvents, bool docorrection, double toffactor,
+      double tofshift) const;
 
   template <class T>
   static void multiplyHelper(std::vector<T> &events, const double value,
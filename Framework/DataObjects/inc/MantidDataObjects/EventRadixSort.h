@@ -0,0 +1,55 @@
+// Mantid Repository : https://github.com/mantidproject/mantid
+//
+// Copyright &copy; 2020 ISIS Rutherford Appleton Laboratory UKRI,
+//   NScD Oak Ridge National Laboratory, European Spallation Source,
+//   Institut Laue - Langevin & CSNS, Institute of High Energy Physics, CAS
+// SPDX - License - Identifier: GPL - 3.0 +
+#pragma once
+
+#include "MantidDataObjects/Events.h"
+#include "MantidKernel/System.h"
+
+#include <cstddef>
+#include <vector>
+
+namespace Mantid {
+namespace DataObjects {
+
+/** EventRadixSort : Stable least-significant-digit radix sorts of event
+  vectors by time-of-flight or by pulse time.
+
+  The tof (a double) and the pulse time (int64 nanoseconds) are mapped onto
+  unsigned 64 bit keys with the same ordering, which are then sorted 11 bits
+  at a time. Digits that are identical for every event, such as the exponent
+  bits of a tof range or the high bits of the pulse times of one run, are
+  detected up front and their passes skipped. The parallel variant splits each
+  pass into blocks whose digit counts are combined before scattering, which
+  keeps the sort stable; it is intended for very large single spectra such as
+  monitors.
+
+  The sorts need a scratch buffer the size of the input, so they are only
+  worthwhile above a few thousand events; see the thresholds below, which
+  EventList uses to choose between these and a comparison sort.
+*/
+class DLLExport EventRadixSort {
+public:
+  /// Lists shorter than this are faster to sort by comparison
+  static constexpr std::size_t MIN_EVENTS = 4096;
+  /// Lists at least this long are sorted using several threads
+  static constexpr std::size_t MIN_PARALLEL_EVENTS = 1 << 20;
+
+  static void sortTof(std::vector<Types::Event::TofEvent> &events,
+                      bool parallel = false);
+  static void sortTof(std::vector<WeightedEvent> &events,
+                      bool parallel = false);
+  static void sortTof(std::vector<WeightedEventNoTime> &events,
+                      bool parallel = false);
+
+  static void sortPulseTime(std::vector<Types::Event::TofEvent> &events,
+                            bool parallel = false);
+  static void sortPulseTime(std::vector<WeightedEvent> &events,
+                            bool parallel = false);
+};
+
+} // namespace DataObjects
+} // namespace Mantid
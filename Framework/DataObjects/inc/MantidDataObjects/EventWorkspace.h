@@ -140,6 +140,10 @@ public:
   bool isHistogramData() const override;
 
   std::size_t MRUSize() const;
+  bool MRUEmpty() const;
+  std::size_t MRUHits() const;
+  std::size_t MRUMisses() const;
+  void resetMRUCounters() const;
 
   void clearMRU() const override;
 
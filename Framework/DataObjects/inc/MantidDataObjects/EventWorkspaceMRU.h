@@ -15,6 +15,7 @@
 
 #include "Poco/RWLock.h"
 
+#include <atomic>
 #include <cstdint>
 #include <vector>
 
@@ -82,11 +83,22 @@ public:
 
   void deleteIndex(const EventList *index);
 
+  bool containsIndex(const EventList *index) const;
+  bool empty() const;
+  void addToIndex(const EventList *index, const MantidVec &deltaY,
+                  const MantidVec &deltaE);
+
   /** Return how many entries in the Y MRU list are used.
    * Only used in tests. It only returns the 0-th MRU list size.
    * @return :: number of entries in the MRU list. */
   size_t MRUSize() const;
 
+  /// @return the number of lookups that found a cached histogram
+  size_t hits() const { return m_hits.load(std::memory_order_relaxed); }
+  /// @return the number of lookups that had to generate a histogram
+  size_t misses() const { return m_misses.load(std::memory_order_relaxed); }
+  void resetCounters();
+
 protected:
   /// The most-recently-used list of dataY histograms
   mutable std::vector<std::unique_ptr<mru_listY>> m_bufferedDataY;
@@ -97,6 +109,12 @@ protected:
   /// Mutex when adding entries in the MRU list
   mutable Poco::RWLock m_changeMruListsMutexE;
   mutable Poco::RWLock m_changeMruListsMutexY;
+
+  /// Number of lookups that found a cached histogram. Counted without
+  /// ordering, so that lookups do not synchronize on it.
+  std::atomic<size_t> m_hits{0};
+  /// Number of lookups that found nothing
+  std::atomic<size_t> m_misses{0};
 };
 
 } // namespace DataObjects
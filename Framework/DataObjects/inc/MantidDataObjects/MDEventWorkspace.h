@@ -142,7 +142,10 @@ public:
 
   void splitAllIfNeeded(Kernel::ThreadScheduler *ts) override;
 
-  void splitTrackedBoxes(Kernel::ThreadScheduler *ts);
+  API::IMDNode *addTrackedEvent(const MDE &event);
+
+  void splitTrackedBoxes(std::vector<API::IMDNode *> &boxes,
+                         Kernel::ThreadScheduler *ts);
 
   void splitBox() override;
 
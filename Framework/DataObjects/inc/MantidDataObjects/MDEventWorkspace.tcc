@@ -629,31 +629,76 @@ TMDE(void MDEventWorkspace)::splitAllIfNeeded(Kernel::ThreadScheduler *ts) {
 }
 
 //-----------------------------------------------------------------------------------------------
-/** Goes through the MDBoxes that were tracked by the BoxController
- * as being too large, and splits them.
+/** Add a single event to the box of this workspace containing it, and
+ * return that box so that the caller can track the boxes that grew.
+ * Automatic splitting is not performed after adding (call
+ * splitTrackedBoxes with the tracked boxes).
+ *
+ * Warning! No bounds checking is done, as in MDGridBox::addEvent.
+ *
+ * @param event :: event to add.
+ * @return the leaf box the event was added to; NULL if it was not added.
+ */
+TMDE(API::IMDNode *MDEventWorkspace)::addTrackedEvent(const MDE &event) {
+  MDBoxBase<MDE, nd> *box = data.get();
+  while (box && !box->isLeaf())
+    box = static_cast<MDGridBox<MDE, nd> *>(box)->getChildForEvent(event);
+  if (!box)
+    return nullptr;
+  box->addEvent(event);
+  return box;
+}
+
+//-----------------------------------------------------------------------------------------------
+/** Goes through the MDBoxes that were tracked as having events added
+ * (see addTrackedEvent), and splits the ones that are now too large.
+ * Unlike splitAllIfNeeded, the rest of the box structure is not visited.
+ *
+ * @param boxes :: the tracked leaf boxes. Sorted and made unique in place;
+ *        a box may appear any number of times. Boxes that are split are
+ *        deleted, so the pointers must not be used afterwards.
  * @param ts :: optional ThreadScheduler * that will be used to parallelize
- *        recursive splitting.
+ *        recursive splitting. Set to NULL to do it serially.
  */
-TMDE(void MDEventWorkspace)::splitTrackedBoxes(Kernel::ThreadScheduler *ts) {
-  UNUSED_ARG(ts);
-  throw std::runtime_error("Not implemented yet");
-  //    // Get a COPY of the vector (to avoid thread-safety issues)
-  //    std::vector<void *> boxes = this->getBoxController()->getBoxesToSplit();
-  //    //PRAGMA_OMP( parallel for )
-  //    for (int i=0; i<int(boxes.size()); i++)
-  //    {
-  //      MDBox<MDE,nd> * box = dynamic_cast<MDBox<MDE,nd> *>(boxes[i]);
-  //      if (box)
-  //      {
-  //        MDGridBox<MDE,nd> * parent = dynamic_cast<MDGridBox<MDE,nd>
-  //        *>(box->getParent());
-  //        if (parent)
-  //        {
-  //          parent->splitContents(parent->getChildIndexFromID(box->getId()),
-  //          ts);
-  //        }
-  //      }
-  //    }
+TMDE(void MDEventWorkspace)::splitTrackedBoxes(
+    std::vector<API::IMDNode *> &boxes, Kernel::ThreadScheduler *ts) {
+  std::sort(boxes.begin(), boxes.end());
+  boxes.erase(std::unique(boxes.begin(), boxes.end()), boxes.end());
+
+  // Find every box to split before splitting any, as the tasks splitting
+  // them replace the children of their parents
+  std::vector<std::pair<MDGridBox<MDE, nd> *, size_t>> toSplit;
+  for (auto node : boxes) {
+    auto *box = dynamic_cast<MDBox<MDE, nd> *>(node);
+    if (!box)
+      continue;
+    if (!this->m_BoxController->willSplit(box->getNPoints(),
+                                          box->getDepth())) {
+      // As in splitAllIfNeeded, write boxes that keep new events in memory
+      Kernel::ISaveable *const pSaver(box->getISaveable());
+      if (pSaver && box->getDataInMemorySize() > 0)
+        this->m_BoxController->getFileIO()->toWrite(pSaver);
+      continue;
+    }
+    auto *parent = dynamic_cast<MDGridBox<MDE, nd> *>(box->getParent());
+    if (!parent) {
+      // The workspace holds a single box
+      this->splitBox();
+      data->splitAllIfNeeded(ts);
+      continue;
+    }
+    toSplit.emplace_back(parent, parent->getChildIndexFromID(box->getID()));
+  }
+
+  for (const auto &split : toSplit) {
+    if (ts)
+      // Task is : parent->splitContents(index, ts);
+      ts->push(std::make_shared<Kernel::FunctionTask>(
+          std::bind(&MDGridBox<MDE, nd>::splitContents, split.first,
+                    split.second, ts)));
+    else
+      split.first->splitContents(split.second, nullptr);
+  }
 }
 
 //-----------------------------------------------------------------------------------------------
@@ -138,6 +138,7 @@ public:
   //----------------------------------------------------------------------------------------------------------------------
   size_t addEvent(const MDE &event) override;
   size_t addEventUnsafe(const MDE &event) override;
+  MDBoxBase<MDE, nd> *getChildForEvent(const MDE &event);
 
   /*--------------->  EVENTS from event data
    * <-------------------------------------------------------------*/
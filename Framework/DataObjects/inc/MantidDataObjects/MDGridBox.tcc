@@ -1723,6 +1723,30 @@ TMDE(inline size_t MDGridBox)::addEventUnsafe(const MDE &event) {
     return 0;
 }
 
+//-----------------------------------------------------------------------------------------------
+/** Get the child box that addEvent() would pass the event on to.
+ *
+ * Warning! No bounds checking is done (for performance). It must
+ * be known that the event is within the bounds of the grid box.
+ *
+ * @param event :: reference to a MDLeanEvent.
+ * @return the child box holding the event's position; NULL if the event
+ * falls past the last child
+ * */
+template <typename MDE, size_t nd>
+MDBoxBase<MDE, nd> *MDGridBox<MDE, nd>::getChildForEvent(const MDE &event) {
+  size_t cindex = calculateChildIndex(event);
+
+  // As in addEvent, events on the upper boundary go to the last box
+  if (cindex == numBoxes)
+    cindex = numBoxes - 1;
+
+  if (cindex < numBoxes)
+    return m_Children[cindex];
+  else
+    return nullptr;
+}
+
 /**Sets particular child MDgridBox at the index, specified by the input
  *parameters
  *@param index     -- the position of the new child in the list of GridBox
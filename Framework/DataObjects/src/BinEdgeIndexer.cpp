@@ -0,0 +1,141 @@
+// Mantid Repository : https://github.com/mantidproject/mantid
+//
+// Copyright &copy; 2020 ISIS Rutherford Appleton Laboratory UKRI,
+//   NScD Oak Ridge National Laboratory, European Spallation Source,
+//   Institut Laue - Langevin & CSNS, Institute of High Energy Physics, CAS
+// SPDX - License - Identifier: GPL - 3.0 +
+#include "MantidDataObjects/BinEdgeIndexer.h"
+
+#include <algorithm>
+#include <cmath>
+
+namespace Mantid {
+namespace DataObjects {
+
+namespace {
+/// Relative tolerance used when deciding whether the edges are regular. It
+/// only affects the quality of the first guess, never the final index.
+constexpr double SPACING_TOLERANCE = 1e-6;
+/// Number of values whose closed-form guess is computed in one pass
+constexpr std::size_t BLOCK_SIZE = 256;
+} // namespace
+
+/** Constructor
+ * @param edges :: the bin edges, in ascending order. The vector must outlive
+ * this object.
+ */
+BinEdgeIndexer::BinEdgeIndexer(const std::vector<double> &edges)
+    : m_edges(edges), m_numBins(edges.size() > 1 ? edges.size() - 1 : 0),
+      m_spacing(Spacing::Arbitrary), m_origin(0.), m_inverseStep(0.) {
+  detectSpacing();
+}
+
+/// Decide whether the edges are linear, logarithmic or arbitrary
+void BinEdgeIndexer::detectSpacing() {
+  if (m_numBins == 0)
+    return;
+  const double first = m_edges.front();
+  const double last = m_edges.back();
+  if (!(last > first) || !std::isfinite(first) || !std::isfinite(last))
+    return;
+
+  const double step = (last - first) / static_cast<double>(m_numBins);
+  bool linear = true;
+  for (std::size_t i = 0; i < m_numBins && linear; ++i)
+    linear = std::fabs((m_edges[i + 1] - m_edges[i]) - step) <=
+             SPACING_TOLERANCE * step;
+  if (linear) {
+    m_spacing = Spacing::Linear;
+    m_origin = first;
+    m_inverseStep = 1. / step;
+    return;
+  }
+
+  if (first <= 0.)
+    return;
+  const double logStep =
+      std::log(last / first) / static_cast<double>(m_numBins);
+  const double ratio = std::exp(logStep);
+  bool logarithmic = true;
+  for (std::size_t i = 0; i < m_numBins && logarithmic; ++i)
+    logarithmic = std::fabs(m_edges[i + 1] - m_edges[i] * ratio) <=
+                  SPACING_TOLERANCE * (m_edges[i + 1] - m_edges[i]);
+  if (logarithmic) {
+    m_spacing = Spacing::Logarithmic;
+    m_origin = std::log(first);
+    m_inverseStep = 1. / logStep;
+  }
+}
+
+/** Turn an estimated bin index into the exact one by comparing against the
+ * neighbouring edges.
+ * @param x :: the value to place
+ * @param guess :: estimated (fractional) bin index
+ * @return the bin index, or npos if x is outside the edges
+ */
+std::size_t BinEdgeIndexer::correct(const double x, double guess) const {
+  if (!(x >= m_edges.front()) || !(x < m_edges.back()))
+    return npos;
+  guess = std::min(std::max(guess, 0.), static_cast<double>(m_numBins - 1));
+  auto bin = static_cast<std::size_t>(guess);
+  // x >= edges[0] and x < edges[numBins], so neither loop can run off the end
+  while (x < m_edges[bin])
+    --bin;
+  while (x >= m_edges[bin + 1])
+    ++bin;
+  return bin;
+}
+
+/** Find the bin of a single value
+ * @param x :: the value to place
+ * @return the bin index, or npos if x is outside the edges
+ */
+std::size_t BinEdgeIndexer::index(const double x) const {
+  switch (m_spacing) {
+  case Spacing::Linear:
+    return correct(x, (x - m_origin) * m_inverseStep);
+  case Spacing::Logarithmic:
+    return correct(x, (std::log(x) - m_origin) * m_inverseStep);
+  case Spacing::Arbitrary:
+    break;
+  }
+  if (m_numBins == 0 || !(x >= m_edges.front()) || !(x < m_edges.back()))
+    return npos;
+  return static_cast<std::size_t>(
+      std::upper_bound(m_edges.cbegin(), m_edges.cend(), x) -
+      m_edges.cbegin() - 1);
+}
+
+/** Find the bins of many values. For regular edges the closed-form estimates
+ * are computed for a whole block at a time, in a branch-free loop that can be
+ * vectorized, before being corrected one by one.
+ * @param values :: the values to place
+ * @param count :: the number of values
+ * @param out :: receives the bin index of each value, or npos
+ */
+void BinEdgeIndexer::indices(const double *values, const std::size_t count,
+                             std::size_t *out) const {
+  if (m_spacing == Spacing::Arbitrary) {
+    for (std::size_t i = 0; i < count; ++i)
+      out[i] = index(values[i]);
+    return;
+  }
+
+  double guesses[BLOCK_SIZE];
+  for (std::size_t start = 0; start < count; start += BLOCK_SIZE) {
+    const std::size_t num = std::min(BLOCK_SIZE, count - start);
+    const double *block = values + start;
+    if (m_spacing == Spacing::Linear) {
+      for (std::size_t i = 0; i < num; ++i)
+        guesses[i] = (block[i] - m_origin) * m_inverseStep;
+    } else {
+      for (std::size_t i = 0; i < num; ++i)
+        guesses[i] = (std::log(block[i]) - m_origin) * m_inverseStep;
+    }
+    for (std::size_t i = 0; i < num; ++i)
+      out[start + i] = correct(block[i], guesses[i]);
+  }
+}
+
+} // namespace DataObjects
+} // namespace Mantid
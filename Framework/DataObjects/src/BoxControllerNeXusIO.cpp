@@ -13,7 +13,10 @@
 #include "MantidDataObjects/MDEvent.h"
 #include "MantidKernel/ConfigService.h"
 #include "MantidKernel/Exception.h"
+#include "MantidKernel/Logger.h"
 
+#include <algorithm>
+#include <chrono>
 #include <string>
 
 namespace Mantid {
@@ -24,6 +27,23 @@ const char *EventHeaders[] = {
     "signal, errorSquared, center (each dim.)",
     "signal, errorSquared, runIndex, detectorId, center (each dim.)"};
 
+namespace {
+/// Default number of events in a page of the read cache
+constexpr int DEFAULT_PAGE_EVENTS = 65536;
+/// Default memory budget of the read cache, in MB
+constexpr int DEFAULT_CACHE_MB = 256;
+/// Default number of pages read after a page missing from the cache
+constexpr int DEFAULT_READ_AHEAD_PAGES = 0;
+
+Kernel::Logger g_log("BoxControllerNeXusIO");
+
+/// Get a non-negative integer setting from the config service
+size_t configValue(const std::string &key, const int defaultValue) {
+  const auto value = Kernel::ConfigService::Instance().getValue<int>(key);
+  return static_cast<size_t>(std::max(0, value.get_value_or(defaultValue)));
+}
+} // namespace
+
 std::string BoxControllerNeXusIO::g_EventGroupName("event_data");
 std::string BoxControllerNeXusIO::g_DBDataName("free_space_blocks");
 
@@ -34,7 +54,9 @@ BoxControllerNeXusIO::BoxControllerNeXusIO(API::BoxController *const bc)
     : m_File(nullptr), m_ReadOnly(true), m_dataChunk(DATA_CHUNK), m_bc(bc),
       m_BlockStart(2, 0), m_BlockSize(2, 0), m_CoordSize(sizeof(coord_t)),
       m_EventType(FatEvent), m_EventsVersion("1.0"),
-      m_ReadConversion(noConversion) {
+      m_ReadConversion(noConversion), m_pageEvents(0), m_memoryBudget(0),
+      m_readAheadPages(0), m_fileValueSize(sizeof(coord_t)), m_cachedBytes(0),
+      m_cacheGeneration(0) {
   m_BlockSize[1] = 4 + m_bc->getNDims();
 
   for (auto &EventHeader : EventHeaders) {
@@ -44,6 +66,12 @@ BoxControllerNeXusIO::BoxControllerNeXusIO(API::BoxController *const bc)
   m_EventsTypesSupported.resize(2);
   m_EventsTypesSupported[LeanEvent] = MDLeanEvent<1>::getTypeName();
   m_EventsTypesSupported[FatEvent] = MDEvent<1>::getTypeName();
+
+  setPageCache(
+      configValue("mdfilebacked.pagesize", DEFAULT_PAGE_EVENTS),
+      uint64_t(configValue("mdfilebacked.cachesize", DEFAULT_CACHE_MB)) *
+          1024 * 1024,
+      configValue("mdfilebacked.readahead", DEFAULT_READ_AHEAD_PAGES));
 }
 /**get event type form its string representation*/
 BoxControllerNeXusIO::EventType BoxControllerNeXusIO::TypeFromString(
@@ -231,6 +259,7 @@ void BoxControllerNeXusIO::prepareNxSToWrite_CurVersion() {
       m_File->makeCompData("event_data", ::NeXus::FLOAT64, m_BlockSize,
                            ::NeXus::NONE, chunk, true);
 
+    m_fileValueSize = m_CoordSize;
     // A little bit of description for humans to read later
     m_File->putAttr("description", m_EventsTypeHeaders[m_EventType]);
     // disk buffer knows that the file has no events
@@ -253,10 +282,12 @@ void BoxControllerNeXusIO::prepareNxSdata_CurVersion() {
   m_ReadConversion = noConversion;
   switch (Type) {
   case (::NeXus::FLOAT64):
+    m_fileValueSize = 8;
     if (m_CoordSize == 4)
       m_ReadConversion = doubleToFolat;
     break;
   case (::NeXus::FLOAT32):
+    m_fileValueSize = 4;
     if (m_CoordSize == 8)
       m_ReadConversion = floatToDouble;
     break;
@@ -353,6 +384,7 @@ void BoxControllerNeXusIO::saveGenericBlock(
     if (blockPosition + dims[0] > this->getFileLength())
       this->setFileLength(blockPosition + dims[0]);
   }
+  invalidatePages(blockPosition, static_cast<uint64_t>(dims[0]));
 }
 
 /** Save float data block on specific position within properly opened NeXus data
@@ -388,16 +420,39 @@ void BoxControllerNeXusIO::loadGenericBlock(std::vector<Type> &Block,
     throw Kernel::Exception::FileError("Attemtp to read behind the file end",
                                        m_fileName);
 
-  std::vector<int64_t> start(2, 0);
-  std::vector<int64_t> size(m_BlockSize);
+  if (m_pageEvents == 0) {
+    std::vector<int64_t> start(2, 0);
+    std::vector<int64_t> size(m_BlockSize);
 
-  std::lock_guard<std::mutex> _lock(m_fileMutex);
+    std::lock_guard<std::mutex> _lock(m_fileMutex);
+
+    start[0] = static_cast<int64_t>(blockPosition);
+    size[0] = static_cast<int64_t>(nPoints);
+    Block.resize(size[0] * size[1]);
 
-  start[0] = static_cast<int64_t>(blockPosition);
-  size[0] = static_cast<int64_t>(nPoints);
-  Block.resize(size[0] * size[1]);
+    m_File->getSlab(&Block[0], start, size);
+    return;
+  }
 
-  m_File->getSlab(&Block[0], start, size);
+  // Copy the events out of the pages holding them
+  const auto nColumns = static_cast<size_t>(m_BlockSize[1]);
+  Block.resize(nPoints * nColumns);
+  auto out = Block.begin();
+  const uint64_t end = blockPosition + nPoints;
+  for (uint64_t event = blockPosition; event < end;) {
+    const uint64_t pageIndex = event / m_pageEvents;
+    const uint64_t pageStart = pageIndex * m_pageEvents;
+    const auto page = fetchPage(pageIndex);
+    const uint64_t pageEnd = std::min(end, pageStart + page->numEvents);
+    if (pageEnd <= event)
+      throw Kernel::Exception::FileError("Attemtp to read behind the file end",
+                                         m_fileName);
+
+    const auto first = reinterpret_cast<const Type *>(page->data.data()) +
+                       (event - pageStart) * nColumns;
+    out = std::copy(first, first + (pageEnd - event) * nColumns, out);
+    event = pageEnd;
+  }
 }
 
 /** Helper funcion which allows to convert one data fomat into another */
@@ -467,11 +522,238 @@ void BoxControllerNeXusIO::flushData() const {
   std::lock_guard<std::mutex> _lock(m_fileMutex);
   m_File->flush();
 }
+/** Set up the cache of pages the events are read through
+ *@param pageEvents     -- the number of events in a page. Zero reads every
+ *                         block straight from the file
+ *@param memoryBudget   -- the number of bytes the cached pages may take up
+ *@param readAheadPages -- the number of pages read along with a page missing
+ *                         from the cache, when the page before it is cached */
+void BoxControllerNeXusIO::setPageCache(const size_t pageEvents,
+                                        const uint64_t memoryBudget,
+                                        const size_t readAheadPages) {
+  std::lock_guard<std::mutex> lock(m_pageMutex);
+  clearPageCache();
+  m_pageEvents = pageEvents;
+  m_memoryBudget = memoryBudget;
+  m_readAheadPages = readAheadPages;
+  m_statistics = PageCacheStatistics();
+}
+
+/// @return the statistics of the page cache since it was set up
+BoxControllerNeXusIO::PageCacheStatistics
+BoxControllerNeXusIO::getPageCacheStatistics() const {
+  std::lock_guard<std::mutex> lock(m_pageMutex);
+  return m_statistics;
+}
+
+/** Get a page from the cache, reading it if it is not there. When the page
+ * before it is cached, the pages after it are read along with it.
+ *@param pageIndex -- the index of the page in the file
+ *@returns the page */
+BoxControllerNeXusIO::PagePtr
+BoxControllerNeXusIO::fetchPage(const uint64_t pageIndex) const {
+  std::shared_future<PagePtr> inFlight;
+  std::vector<std::promise<PagePtr>> toRead;
+  uint64_t generation;
+  {
+    std::lock_guard<std::mutex> lock(m_pageMutex);
+    const auto cached = m_pages.find(pageIndex);
+    if (cached != m_pages.end()) {
+      ++m_statistics.hits;
+      m_pageOrder.splice(m_pageOrder.begin(), m_pageOrder,
+                         cached->second.order);
+      return cached->second.page;
+    }
+    const auto reading = m_pagesInFlight.find(pageIndex);
+    if (reading != m_pagesInFlight.end()) {
+      ++m_statistics.hits;
+      inFlight = reading->second;
+    } else {
+      ++m_statistics.misses;
+      toRead = reservePages(pageIndex);
+      inFlight = m_pagesInFlight[pageIndex];
+    }
+    generation = m_cacheGeneration;
+  }
+
+  const auto waitStart = std::chrono::steady_clock::now();
+  if (!toRead.empty())
+    readInto(pageIndex, toRead, generation);
+  auto page = inFlight.get();
+  const std::chrono::duration<double> waited =
+      std::chrono::steady_clock::now() - waitStart;
+
+  std::lock_guard<std::mutex> lock(m_pageMutex);
+  m_statistics.ioWaitSeconds += waited.count();
+  return page;
+}
+
+/** Mark a page missing from the cache as being read, with the pages after it
+ * that are neither cached nor being read if the page before it is cached, so
+ * that reading in order fetches several pages at once. Called with the page
+ * mutex held.
+ *@param pageIndex -- the index of the page missing from the cache
+ *@returns the promises of the pages to read, starting at pageIndex */
+std::vector<std::promise<BoxControllerNeXusIO::PagePtr>>
+BoxControllerNeXusIO::reservePages(const uint64_t pageIndex) const {
+  uint64_t lastPage = pageIndex + 1;
+  if (pageIndex == 0 || m_pages.find(pageIndex - 1) != m_pages.end()) {
+    const uint64_t numPages =
+        (this->getFileLength() + m_pageEvents - 1) / m_pageEvents;
+    const uint64_t readAheadEnd =
+        std::min(numPages, pageIndex + 1 + m_readAheadPages);
+    while (lastPage < readAheadEnd && m_pages.find(lastPage) == m_pages.end() &&
+           m_pagesInFlight.find(lastPage) == m_pagesInFlight.end())
+      ++lastPage;
+  }
+  std::vector<std::promise<PagePtr>> promises(lastPage - pageIndex);
+  for (size_t i = 0; i < promises.size(); ++i)
+    m_pagesInFlight.emplace(pageIndex + i, promises[i].get_future().share());
+  return promises;
+}
+
+/** Read consecutive pages from the file
+ *@param firstPage -- the index of the first page in the file
+ *@param numPages  -- the number of pages to read
+ *@returns the pages, the last of which is shorter than the others at the end
+ *         of the file */
+std::vector<BoxControllerNeXusIO::PagePtr>
+BoxControllerNeXusIO::readPages(const uint64_t firstPage,
+                                const size_t numPages) const {
+  std::vector<PagePtr> pages;
+  pages.reserve(numPages);
+  std::vector<int64_t> start(2, 0);
+  std::vector<int64_t> size(m_BlockSize);
+
+  std::lock_guard<std::mutex> _lock(m_fileMutex);
+  for (uint64_t pageIndex = firstPage; pageIndex < firstPage + numPages;
+       ++pageIndex) {
+    const uint64_t pageStart = pageIndex * m_pageEvents;
+    auto page = std::make_shared<Page>();
+    page->numEvents =
+        std::min<uint64_t>(m_pageEvents, this->getFileLength() - pageStart);
+    page->data.resize(page->numEvents * static_cast<size_t>(m_BlockSize[1]) *
+                      m_fileValueSize);
+    start[0] = static_cast<int64_t>(pageStart);
+    size[0] = static_cast<int64_t>(page->numEvents);
+    m_File->getSlab(page->data.data(), start, size);
+    pages.emplace_back(std::move(page));
+  }
+  return pages;
+}
+
+/** Read consecutive pages from the file and hand them to the readers waiting
+ * for them.
+ *@param firstPage  -- the index of the first page in the file
+ *@param promises   -- the promises the waiting readers hold the futures of,
+ *                     one for each page
+ *@param generation -- the cache generation when the read was asked for. The
+ *                     pages are not cached if the file was written since  */
+void BoxControllerNeXusIO::readInto(
+    const uint64_t firstPage, std::vector<std::promise<PagePtr>> &promises,
+    const uint64_t generation) const {
+  std::vector<PagePtr> pages;
+  try {
+    pages = readPages(firstPage, promises.size());
+  } catch (...) {
+    {
+      std::lock_guard<std::mutex> lock(m_pageMutex);
+      if (generation == m_cacheGeneration) {
+        for (size_t i = 0; i < promises.size(); ++i)
+          m_pagesInFlight.erase(firstPage + i);
+      }
+    }
+    for (auto &promise : promises)
+      promise.set_exception(std::current_exception());
+    return;
+  }
+  {
+    std::lock_guard<std::mutex> lock(m_pageMutex);
+    // cache the first page last, so it is the most recently used
+    for (size_t i = pages.size(); i-- > 0;) {
+      ++m_statistics.pagesRead;
+      m_statistics.bytesRead += pages[i]->data.size();
+      if (generation == m_cacheGeneration) {
+        m_pagesInFlight.erase(firstPage + i);
+        cachePage(firstPage + i, pages[i]);
+      }
+    }
+  }
+  for (size_t i = 0; i < pages.size(); ++i)
+    promises[i].set_value(std::move(pages[i]));
+}
+
+/** Add a page to the cache, dropping the least recently used pages to keep
+ * within the memory budget. Called with the page mutex held.
+ *@param pageIndex -- the index of the page in the file
+ *@param page      -- the page */
+void BoxControllerNeXusIO::cachePage(const uint64_t pageIndex,
+                                     PagePtr page) const {
+  if (m_pages.find(pageIndex) != m_pages.end())
+    return;
+  m_cachedBytes += page->data.size();
+  m_pageOrder.push_front(pageIndex);
+  m_pages.emplace(pageIndex, CachedPage{std::move(page), m_pageOrder.begin()});
+
+  while (m_cachedBytes > m_memoryBudget && m_pageOrder.size() > 1) {
+    const auto oldest = m_pages.find(m_pageOrder.back());
+    m_cachedBytes -= oldest->second.page->data.size();
+    m_pages.erase(oldest);
+    m_pageOrder.pop_back();
+  }
+}
+
+/** Drop the cached pages holding the events given, and the last page if it
+ * is shorter than the others as the file may have grown. Pages being read
+ * are forgotten and will not be cached when they arrive.
+ *@param firstEvent -- the position of the first event written
+ *@param numEvents  -- the number of events written */
+void BoxControllerNeXusIO::invalidatePages(const uint64_t firstEvent,
+                                           const uint64_t numEvents) const {
+  std::lock_guard<std::mutex> lock(m_pageMutex);
+  if (m_pageEvents == 0)
+    return;
+  ++m_cacheGeneration;
+  m_pagesInFlight.clear();
+  for (auto cached = m_pages.begin(); cached != m_pages.end();) {
+    const uint64_t pageStart = cached->first * m_pageEvents;
+    const auto &page = cached->second.page;
+    if (page->numEvents < m_pageEvents ||
+        (pageStart < firstEvent + numEvents &&
+         firstEvent < pageStart + page->numEvents)) {
+      m_cachedBytes -= page->data.size();
+      m_pageOrder.erase(cached->second.order);
+      cached = m_pages.erase(cached);
+    } else {
+      ++cached;
+    }
+  }
+}
+
+/// Drop every cached page. Called with the page mutex held.
+void BoxControllerNeXusIO::clearPageCache() {
+  ++m_cacheGeneration;
+  m_pagesInFlight.clear();
+  m_pages.clear();
+  m_pageOrder.clear();
+  m_cachedBytes = 0;
+}
+
 /** flush disk buffer data from memory and close underlying NeXus file*/
 void BoxControllerNeXusIO::closeFile() {
   if (m_File) {
     // write all file-backed data still stack in the data buffer into the file.
     this->flushCache();
+    {
+      std::lock_guard<std::mutex> lock(m_pageMutex);
+      clearPageCache();
+      if (m_statistics.hits + m_statistics.misses > 0)
+        g_log.debug() << "Page cache of " << m_fileName << ": "
+                      << m_statistics.hits << " hits, " << m_statistics.misses
+                      << " misses, " << m_statistics.pagesRead
+                      << " pages read, " << m_statistics.ioWaitSeconds
+                      << " s waiting for the file\n";
+    }
     // lock file
     std::lock_guard<std::mutex> _lock(m_fileMutex);
 
@@ -6,6 +6,8 @@
 // SPDX - License - Identifier: GPL - 3.0 +
 #include "MantidDataObjects/EventList.h"
 #include "MantidAPI/MatrixWorkspace.h"
+#include "MantidDataObjects/BinEdgeIndexer.h"
+#include "MantidDataObjects/EventRadixSort.h"
 #include "MantidDataObjects/EventWorkspaceMRU.h"
 #include "MantidDataObjects/Histogram1D.h"
 #include "MantidKernel/DateAndTime.h"
@@ -18,15 +20,18 @@
 // qualifier applied to function type has no meaning; ignored
 #pragma warning(disable : 4180)
 #endif
+#include "tbb/parallel_for.h"
 #include "tbb/parallel_sort.h"
 #ifdef _MSC_VER
 #pragma warning(default : 4180)
 #endif
 
+#include <array>
 #include <cfloat>
 #include <cmath>
 #include <functional>
 #include <limits>
+#include <map>
 #include <stdexcept>
 
 using std::ostream;
@@ -89,6 +94,138 @@ public:
     return (tAtSample1 < tAtSample2);
   }
 };
+
+/// Calculates the full time of events, with an optional tof correction
+class FullTimeCalculator {
+public:
+  FullTimeCalculator(const bool docorrection, const double tofFactor,
+                     const double tofShift)
+      : m_tofFactor(docorrection ? tofFactor : 1.0),
+        m_tofShift(docorrection ? tofShift : 0.0) {}
+  template <typename EventType>
+  int64_t operator()(const EventType &event) const {
+    return calculateCorrectedFullTime(event, m_tofFactor, m_tofShift);
+  }
+
+private:
+  const double m_tofFactor;
+  const double m_tofShift;
+};
+
+/// A range of consecutive events that all go to the same output
+struct EventRun {
+  size_t begin;
+  size_t end;
+  EventList *output;
+};
+
+/**
+ * Append a range of events to a list of runs, merging it into the last run
+ * if it continues it. Empty ranges and null outputs are ignored.
+ * @param runs : The runs, in the order of the events
+ * @param begin : The index of the first event of the range
+ * @param end : One past the index of the last event of the range
+ * @param output : The output for the events of the range
+ */
+void addEventRun(std::vector<EventRun> &runs, const size_t begin,
+                 const size_t end, EventList *output) {
+  if (begin == end || !output)
+    return;
+  if (!runs.empty() && runs.back().output == output &&
+      runs.back().end == begin)
+    runs.back().end = end;
+  else
+    runs.push_back({begin, end, output});
+}
+
+/**
+ * Look up the output for a splitter target
+ * @param outputs : The outputs, keyed by target
+ * @param target : The target to look up
+ * @return The output, or nullptr if there is none for the target
+ */
+EventList *findSplitOutput(const std::map<int, EventList *> &outputs,
+                           const int target) {
+  const auto it = outputs.find(target);
+  return it == outputs.end() ? nullptr : it->second;
+}
+
+/**
+ * Copy runs of events into their outputs. The events for each output are
+ * counted before any are copied so that each output is allocated once, and
+ * outputs with no events allocate nothing. Different outputs are filled in
+ * parallel when there are many events.
+ * @param events : The events being split
+ * @param runs : The runs of events, in the order of the events
+ * @param order : The sort order of the events, inherited by the outputs as
+ * they receive a subsequence of them
+ */
+template <class T>
+void copyEventRuns(const std::vector<T> &events,
+                   const std::vector<EventRun> &runs,
+                   const EventSortType order) {
+  if (runs.empty())
+    return;
+  // Group the runs by output, keeping them in order within each output
+  std::vector<std::pair<EventList *, size_t>> runsByOutput;
+  runsByOutput.reserve(runs.size());
+  for (size_t i = 0; i < runs.size(); ++i)
+    runsByOutput.emplace_back(runs[i].output, i);
+  std::sort(runsByOutput.begin(), runsByOutput.end());
+  std::vector<size_t> outputStarts;
+  for (size_t i = 0; i < runsByOutput.size(); ++i) {
+    if (i == 0 || runsByOutput[i].first != runsByOutput[i - 1].first)
+      outputStarts.emplace_back(i);
+  }
+  outputStarts.emplace_back(runsByOutput.size());
+
+  auto fillOutput = [&](const size_t outputIndex) {
+    const auto first = runsByOutput.cbegin() + outputStarts[outputIndex];
+    const auto last = runsByOutput.cbegin() + outputStarts[outputIndex + 1];
+    size_t numEvents = 0;
+    for (auto it = first; it != last; ++it)
+      numEvents += runs[it->second].end - runs[it->second].begin;
+    std::vector<T> *outputEvents;
+    getEventsFrom(*first->first, outputEvents);
+    outputEvents->reserve(outputEvents->size() + numEvents);
+    for (auto it = first; it != last; ++it) {
+      const auto &run = runs[it->second];
+      outputEvents->insert(outputEvents->end(), events.cbegin() + run.begin,
+                           events.cbegin() + run.end);
+    }
+    first->first->setSortOrder(order);
+  };
+
+  const size_t numOutputs = outputStarts.size() - 1;
+  if (numOutputs > 1 && events.size() >= EventRadixSort::MIN_PARALLEL_EVENTS)
+    tbb::parallel_for(size_t(0), numOutputs, fillOutput);
+  else
+    for (size_t i = 0; i < numOutputs; ++i)
+      fillOutput(i);
+}
+
+/// @return true if a list of this length should be sorted by radix sort
+bool useRadixSort(const size_t numEvents) {
+  return numEvents >= EventRadixSort::MIN_EVENTS;
+}
+
+/// @return true if a list of this length should be sorted by several threads
+bool useParallelRadixSort(const size_t numEvents) {
+  return numEvents >= EventRadixSort::MIN_PARALLEL_EVENTS;
+}
+
+/**
+ * Sort events by TOF, using a radix sort for long lists, whose cost only
+ * grows linearly with the number of events, and a comparison sort otherwise.
+ * @param events :: the events to sort
+ */
+template <typename EventType>
+void sortEventsByTof(std::vector<EventType> &events) {
+  if (useRadixSort(events.size()))
+    EventRadixSort::sortTof(events, useParallelRadixSort(events.size()));
+  else
+    tbb::parallel_sort(events.begin(), events.end());
+}
 } // namespace
 //==========================================================================
 /// --------------------- TofEvent Comparators
@@ -926,6 +1063,27 @@ void EventList::clearUnused() {
 /// Mask the spectrum to this value. Removes all events.
 void EventList::clearData() { this->clear(false); }
 
+/** If a histogram of this list is held in the MRU, bring it up to date with
+ * the histogram of the events about to be added or subtracted, rather than
+ * regenerating it from all the events on the next access. Call it before
+ * appending the events, so that adding a list to itself is counted once.
+ * The events added are histogrammed, which may sort them.
+ *
+ * @param more_events :: the events being added or subtracted
+ * @param subtract :: true if the events are being subtracted
+ */
+void EventList::addToCachedHistogram(const EventList &more_events,
+                                     const bool subtract) const {
+  if (!mru || !mru->containsIndex(this))
+    return;
+  MantidVec Y;
+  MantidVec E;
+  more_events.generateHistogram(readX(), Y, E);
+  if (subtract)
+    std::transform(Y.cbegin(), Y.cend(), Y.begin(), std::negate<double>());
+  mru->addToIndex(this, Y, E);
+}
+
 /** Sets the MRU list for this event list
  *
  * @param newMRU :: new MRU for the workspace containing this EventList
@@ -953,6 +1111,20 @@ void EventList::reserve(size_t num) {
   }
 }
 
+/** @return the number of events this EventList can hold without reallocating
+ */
+size_t EventList::capacity() const {
+  switch (this->eventType) {
+  case TOF:
+    return this->events.capacity();
+  case WEIGHTED:
+    return this->weightedEvents.capacity();
+  case WEIGHTED_NOTIME:
+    return this->weightedEventsNoTime.capacity();
+  }
+  throw std::runtime_error("EventList: invalid event type value was found.");
+}
+
 // ==============================================================================================
 // --- Sorting functions -----------------------------------------------------
 // ==============================================================================================
@@ -1005,14 +1177,13 @@ void EventList::sortTof() const {
 
   switch (eventType) {
   case TOF:
-    tbb::parallel_sort(events.begin(), events.end());
+    sortEventsByTof(events);
     break;
   case WEIGHTED:
-    tbb::parallel_sort(weightedEvents.begin(), weightedEvents.end());
+    sortEventsByTof(weightedEvents);
     break;
   case WEIGHTED_NOTIME:
-    tbb::parallel_sort(weightedEventsNoTime.begin(),
-                       weightedEventsNoTime.end());
+    sortEventsByTof(weightedEventsNoTime);
     break;
   }
   // Save the order to avoid unnecessary re-sorting.
@@ -1077,11 +1248,19 @@ void EventList::sortPulseTime() const {
   // Perform sort.
   switch (eventType) {
   case TOF:
-    tbb::parallel_sort(events.begin(), events.end(), compareEventPulseTime);
+    if (useRadixSort(events.size()))
+      EventRadixSort::sortPulseTime(events,
+                                    useParallelRadixSort(events.size()));
+    else
+      tbb::parallel_sort(events.begin(), events.end(), compareEventPulseTime);
     break;
   case WEIGHTED:
-    tbb::parallel_sort(weightedEvents.begin(), weightedEvents.end(),
-                       compareEventPulseTime);
+    if (useRadixSort(weightedEvents.size()))
+      EventRadixSort::sortPulseTime(
+          weightedEvents, useParallelRadixSort(weightedEvents.size()));
+    else
+      tbb::parallel_sort(weightedEvents.begin(), weightedEvents.end(),
+                         compareEventPulseTime);
     break;
   case WEIGHTED_NOTIME:
     // Do nothing; there is no time to sort
@@ -1680,6 +1859,8 @@ inline void EventList::compressFatEventsHelper(
     if (it->m_pulsetime >= timeStart)
       break;
   }
+  if (it == events.cend())
+    return;
 
   // bin if the pulses are histogrammed
   int64_t lastPulseBin =
@@ -2039,6 +2220,37 @@ void EventList::histogramForWeightsHelper(const std::vector<T> &events,
                  static_cast<double (*)(double)>(sqrt));
 }
 
+// --------------------------------------------------------------------------
+/** Fill a counts histogram from unweighted events in any order, using a
+ * BinEdgeIndexer to find the bin of each event. The tofs are gathered in
+ * blocks so that the indexer can work on contiguous values. Every event adds
+ * exactly one, so the counts do not depend on the order of the events.
+ *
+ * @param events: vector of events, not necessarily sorted
+ * @param indexer: bin finder for the X-bins
+ * @param Y: counts returned
+ */
+void EventList::countsByIndexHelper(
+    const std::vector<Types::Event::TofEvent> &events,
+    const BinEdgeIndexer &indexer, MantidVec &Y) {
+  Y.assign(indexer.numberOfBins(), 0.0);
+
+  constexpr size_t blockSize = 512;
+  std::array<double, blockSize> tofs;
+  std::array<size_t, blockSize> bins;
+  const size_t numEvents = events.size();
+  for (size_t start = 0; start < numEvents; start += blockSize) {
+    const size_t num = std::min(blockSize, numEvents - start);
+    for (size_t i = 0; i < num; ++i)
+      tofs[i] = events[start + i].tof();
+    indexer.indices(tofs.data(), num, bins.data());
+    for (size_t i = 0; i < num; ++i) {
+      if (bins[i] != BinEdgeIndexer::npos)
+        Y[bins[i]] += 1.0;
+    }
+  }
+}
+
 // --------------------------------------------------------------------------
 /** Generates both the Y and E (error) histograms w.r.t Pulse Time
  * for an EventList with or without WeightedEvents.
@@ -2121,8 +2333,20 @@ void EventList::generateHistogramTimeAtSample(const MantidVec &X, MantidVec &Y,
  */
 void EventList::generateHistogram(const MantidVec &X, MantidVec &Y,
                                   MantidVec &E, bool skipError) const {
-  // All types of weights need to be sorted by TOF
+  // Linear and logarithmic bins give the bin of each event in closed form, so
+  // unweighted events can be counted without sorting them first. Weighted
+  // events are still summed in tof order, which fixes the rounding of the sum.
+  if (this->order != TOF_SORT && eventType == TOF) {
+    const BinEdgeIndexer indexer(X);
+    if (indexer.isClosedForm()) {
+      countsByIndexHelper(this->events, indexer, Y);
+      if (!skipError)
+        this->generateErrorsHistogram(Y, E);
+      return;
+    }
+  }
 
+  // Otherwise all types of weights need to be sorted by TOF
   this->sortTof();
 
   switch (eventType) {
@@ -4184,79 +4408,47 @@ void EventList::splitByTime(Kernel::TimeSplitterType &splitter,
  *toffactor*tof+tofshift
  */
 template <class T>
-void EventList::splitByFullTimeHelper(Kernel::TimeSplitterType &splitter,
-                                      std::map<int, EventList *> outputs,
-                                      typename std::vector<T> &events,
-                                      bool docorrection, double toffactor,
-                                      double tofshift) const {
-  // 1. Prepare to Iterate through the splitter at the same time
-  auto itspl = splitter.begin();
-  auto itspl_end = splitter.end();
-
-  // 2. Prepare to Iterate through all events (sorted by tof)
-  auto itev = events.begin();
-  auto itev_end = events.end();
-
-  // 3. This is the time of the first section. Anything before is thrown out.
-  while (itspl != itspl_end) {
-    // Get the splitting interval times and destination
-    int64_t start = itspl->start().totalNanoseconds();
-    int64_t stop = itspl->stop().totalNanoseconds();
-    const int index = itspl->index();
+void EventList::splitByFullTimeHelper(
+    Kernel::TimeSplitterType &splitter,
+    const std::map<int, EventList *> &outputs, const std::vector<T> &events,
+    bool docorrection, double toffactor, double tofshift) const {
+  const FullTimeCalculator fullTime(docorrection, toffactor, tofshift);
+  EventList *unfiltered = findSplitOutput(outputs, -1);
+
+  // 1. Find the runs of events going to each output, iterating through the
+  // splitter and the events (sorted by pulse time) at the same time
+  std::vector<EventRun> runs;
+  const size_t numEvents = events.size();
+  size_t iev = 0;
+  for (const auto &interval : splitter) {
+    // No need to keep looping through the filter if we are out of events
+    if (iev == numEvents)
+      break;
+    const int64_t start = interval.start().totalNanoseconds();
+    const int64_t stop = interval.stop().totalNanoseconds();
 
-    // a) Skip the events before the start of the time
-    // TODO This step can be
-    EventList *myOutput = outputs[-1];
-    while (itev != itev_end) {
-      int64_t fulltime;
-      if (docorrection)
-        fulltime = calculateCorrectedFullTime(*itev, toffactor, tofshift);
-      else
-        fulltime = itev->m_pulsetime.totalNanoseconds() +
-                   static_cast<int64_t>(itev->m_tof * 1000);
-      if (fulltime < start) {
-        // a1) Record to index = -1 space
-        const T eventCopy(*itev);
-        myOutput->addEventQuickly(eventCopy);
-        itev++;
-      } else {
-        break;
-      }
-    }
+    // a) The events before the start of the interval go to index = -1
+    size_t first = iev;
+    while (iev < numEvents && fullTime(events[iev]) < start)
+      ++iev;
+    addEventRun(runs, first, iev, unfiltered);
 
     // b) Go through all the events that are in the interval (if any)
-    while (itev != itev_end) {
-      int64_t fulltime;
-      if (docorrection)
-        fulltime = itev->m_pulsetime.totalNanoseconds() +
-                   static_cast<int64_t>(toffactor * itev->m_tof * 1000 +
-                                        tofshift * 1.0E9);
-      else
-        fulltime = itev->m_pulsetime.totalNanoseconds() +
-                   static_cast<int64_t>(itev->m_tof * 1000);
-      if (fulltime < stop) {
-        // b1) Add a copy to the output
-        outputs[index]->addEventQuickly(*itev);
-        ++itev;
-      } else {
-        break;
-      }
-    }
-
-    // Go to the next interval
-    ++itspl;
-    // But if we reached the end, then we are done.
-    if (itspl == itspl_end)
-      break;
+    first = iev;
+    while (iev < numEvents && fullTime(events[iev]) < stop)
+      ++iev;
+    addEventRun(runs, first, iev, findSplitOutput(outputs, interval.index()));
+  }
 
-    // No need to keep looping through the filter if we are out of events
-    if (itev == itev_end)
-      break;
-  } // END-WHILE Splitter
+  // 2. Copy them out
+  copyEventRuns(events, runs, order);
 }
 
 //------------------------------------------------------------------------------------------------
 /** Split the event list into n outputs by event's full time (tof + pulse time)
+ *
+ * The events going to each output are counted before any are copied, so each
+ * output is allocated once and outputs receiving no events allocate nothing.
  *
  * @param splitter :: a TimeSplitterType giving where to split
  * @param outputs :: a map of where the split events will end up. The # of
@@ -4268,7 +4460,7 @@ void EventList::splitByFullTimeHelper(Kernel::TimeSplitterType &splitter,
  * @param tofshift:  a correction shift for each TOF to add with
  */
 void EventList::splitByFullTime(Kernel::TimeSplitterType &splitter,
-                                std::map<int, EventList *> outputs,
+                                const std::map<int, EventList *> &outputs,
                                 bool docorrection, double toffactor,
                                 double tofshift) const {
   if (eventType == WEIGHTED_NOTIME)
@@ -4279,9 +4471,8 @@ void EventList::splitByFullTime(Kernel::TimeSplitterType &splitter,
   this->sortPulseTimeTOF();
 
   // 2. Initialize all the outputs
-  std::map<int, EventList *>::iterator outiter;
-  for (outiter = outputs.begin(); outiter != outputs.end(); ++outiter) {
-    EventList *opeventlist = outiter->second;
+  for (const auto &output : outputs) {
+    EventList *opeventlist = output.second;
     opeventlist->clear();
     opeventlist->setDetectorIDs(this->getDetectorIDs());
     opeventlist->setHistogram(m_histogram);
@@ -4292,8 +4483,8 @@ void EventList::splitByFullTime(Kernel::TimeSplitterType &splitter,
   // Do nothing if there are no entries
   if (splitter.empty()) {
     // 3A. Copy all events to group workspace = -1
-    (*outputs[-1]) = (*this);
-    // this->duplicate(outputs[-1]);
+    if (auto unfiltered = findSplitOutput(outputs, -1))
+      *unfiltered = *this;
   } else {
     // 3B. Split
     switch (eventType) {
@@ -4334,24 +4525,26 @@ void EventList::splitByFullTime(Kernel::TimeSplitterType &splitter,
 template <class T>
 std::string EventList::splitByFullTimeVectorSplitterHelper(
     const std::vector<int64_t> &vectimes, const std::vector<int> &vecgroups,
-    std::map<int, EventList *> outputs, typename std::vector<T> &vecEvents,
+    const std::map<int, EventList *> &outputs, const std::vector<T> &vecEvents,
     bool docorrection, double toffactor, double tofshift) const {
-  // Define variables for events
-  // size_t numevents = events.size();
-  typename std::vector<T>::iterator eviter;
+  const FullTimeCalculator fullTime(docorrection, toffactor, tofshift);
   std::stringstream msgss;
 
-  // Loop through events
-  for (eviter = vecEvents.begin(); eviter != vecEvents.end(); ++eviter) {
+  // Loop through events, finding the runs going to each group
+  std::vector<EventRun> runs;
+  auto addGroupRun = [&](const size_t begin, const size_t end,
+                         const int group) {
+    EventList *myOutput = findSplitOutput(outputs, group);
+    if (!myOutput)
+      msgss << "Group " << group << " has a NULL output EventList. "
+            << "\n";
+    addEventRun(runs, begin, end, myOutput);
+  };
+  size_t runStart = 0;
+  int runGroup = 0;
+  for (size_t iev = 0; iev < vecEvents.size(); ++iev) {
     // Obtain time of event
-    int64_t evabstimens;
-    if (docorrection)
-      evabstimens = eviter->m_pulsetime.totalNanoseconds() +
-                    static_cast<int64_t>(toffactor * eviter->m_tof * 1000 +
-                                         tofshift * 1.0E9);
-    else
-      evabstimens = eviter->m_pulsetime.totalNanoseconds() +
-                    static_cast<int64_t>(eviter->m_tof * 1000);
+    const int64_t evabstimens = fullTime(vecEvents[iev]);
 
     // Search in vector
     int index = static_cast<int>(
@@ -4367,19 +4560,18 @@ std::string EventList::splitByFullTimeVectorSplitterHelper(
       group = vecgroups[index - 1];
     }
 
-    // Copy event to the proper group
-    EventList *myOutput = outputs[group];
-    if (!myOutput) {
-      std::stringstream errss;
-      errss << "Group " << group << " has a NULL output EventList. "
-            << "\n";
-      msgss << errss.str();
-    } else {
-      const T eventCopy(*eviter);
-      myOutput->addEventQuickly(eventCopy);
+    if (iev == 0) {
+      runGroup = group;
+    } else if (group != runGroup) {
+      addGroupRun(runStart, iev, runGroup);
+      runStart = iev;
+      runGroup = group;
     }
   }
+  if (runStart < vecEvents.size())
+    addGroupRun(runStart, vecEvents.size(), runGroup);
 
+  copyEventRuns(vecEvents, runs, order);
   return (msgss.str());
 }
 
@@ -4406,82 +4598,46 @@ std::string EventList::splitByFullTimeVectorSplitterHelper(
 template <class T>
 std::string EventList::splitByFullTimeSparseVectorSplitterHelper(
     const std::vector<int64_t> &vectimes, const std::vector<int> &vecgroups,
-    std::map<int, EventList *> outputs, typename std::vector<T> &vecEvents,
+    const std::map<int, EventList *> &outputs, const std::vector<T> &vecEvents,
     bool docorrection, double toffactor, double tofshift) const {
-  // Define variables for events
-  // size_t numevents = events.size();
-  // typename std::vector<T>::iterator eviter;
-  std::stringstream msgss;
+  const FullTimeCalculator fullTime(docorrection, toffactor, tofshift);
 
-  size_t num_splitters = vecgroups.size();
-  // prepare to Iterate through all events (sorted by tof)
-  auto iter_events = vecEvents.begin();
-  auto iter_events_end = vecEvents.end();
-
-  // std::stringstream debug_ss;
-  // debug_ss << "\nFilter events...:\n";
-
-  for (size_t i = 0; i < num_splitters; ++i) {
+  // Find the runs of events going to each splitter
+  std::vector<EventRun> runs;
+  const size_t numEvents = vecEvents.size();
+  size_t iev = 0;
+  for (size_t i = 0; i < vecgroups.size() && iev < numEvents; ++i) {
     // get one splitter
-    int64_t start_i64 = vectimes[i];
-    int64_t stop_i64 = vectimes[i + 1];
-    int group = vecgroups[i];
-    // debug_ss << "working on splitter: " << i << " from " << start_i64 << " to
-    // " << stop_i64 << "\n";
-
-    // go over events
-    while (iter_events != iter_events_end) {
-      int64_t absolute_time;
-      if (docorrection)
-        absolute_time =
-            iter_events->m_pulsetime.totalNanoseconds() +
-            static_cast<int64_t>(toffactor * iter_events->m_tof * 1000 +
-                                 tofshift * 1.0E9);
-      else
-        absolute_time = iter_events->m_pulsetime.totalNanoseconds() +
-                        static_cast<int64_t>(iter_events->m_tof * 1000);
-
-      // debug_ss << "  event " << iter_events - vecEvents.begin() << " abs.time
-      // = " << absolute_time << "\n";
-
-      if (absolute_time < start_i64) {
-        // event occurs before the splitter. only can happen with first
-        // splitter. Then ignore and move to next
-        ++iter_events;
-        continue;
-      }
-
-      if (absolute_time < stop_i64) {
-        // in the splitter, then copy the event into another
-        const T eventCopy(*iter_events);
-        // Copy event to the proper group
-        EventList *myOutput = outputs[group];
-        if (!myOutput) {
-          // there is no such group defined. quit for this group
-          std::stringstream errss;
-          errss << "Group " << group << " has a NULL output EventList. "
-                << "\n";
-          msgss << errss.str();
-          throw std::runtime_error(errss.str());
-        }
-        // Add the copy to the output
-        myOutput->addEventQuickly(eventCopy);
-        ++iter_events;
-      } else {
-        // event occurs after the stop time, it should belonged to the next
-        // splitter
-        break;
-      }
-    } // while
-
-    // quit the loop if there is no more event left
-    if (iter_events == iter_events_end)
-      break;
-  } // for splitter
+    const int64_t start_i64 = vectimes[i];
+    const int64_t stop_i64 = vectimes[i + 1];
+    const int group = vecgroups[i];
+
+    // event occurs before the splitter. only can happen with first
+    // splitter. Then ignore and move to next
+    while (iev < numEvents && fullTime(vecEvents[iev]) < start_i64)
+      ++iev;
+
+    // events in the splitter are copied, up to the first event after the
+    // stop time, which belongs to the next splitter
+    const size_t first = iev;
+    while (iev < numEvents && fullTime(vecEvents[iev]) < stop_i64)
+      ++iev;
+    if (first == iev)
+      continue;
 
-  // std::cout << debug_ss.str();
+    EventList *myOutput = findSplitOutput(outputs, group);
+    if (!myOutput) {
+      // there is no such group defined. quit for this group
+      std::stringstream errss;
+      errss << "Group " << group << " has a NULL output EventList. "
+            << "\n";
+      throw std::runtime_error(errss.str());
+    }
+    addEventRun(runs, first, iev, myOutput);
+  }
 
-  return (msgss.str());
+  copyEventRuns(vecEvents, runs, order);
+  return "";
 }
 
 //----------------------------------------------------------------------------------------------
@@ -4500,7 +4656,7 @@ std::string EventList::splitByFullTimeSparseVectorSplitterHelper(
 std::string EventList::splitByFullTimeMatrixSplitter(
     const std::vector<int64_t> &vec_splitters_time,
     const std::vector<int> &vecgroups,
-    std::map<int, EventList *> vec_outputEventList, bool docorrection,
+    const std::map<int, EventList *> &vec_outputEventList, bool docorrection,
     double toffactor, double tofshift) const {
   // Check validity
   if (eventType == WEIGHTED_NOTIME)
@@ -4512,10 +4668,8 @@ std::string EventList::splitByFullTimeMatrixSplitter(
   sortPulseTimeTOF();
 
   // Initialize all the output event list
-  std::map<int, EventList *>::iterator outiter;
-  for (outiter = vec_outputEventList.begin();
-       outiter != vec_outputEventList.end(); ++outiter) {
-    EventList *opeventlist = outiter->second;
+  for (const auto &output : vec_outputEventList) {
+    EventList *opeventlist = output.second;
     opeventlist->clear();
     opeventlist->setDetectorIDs(this->getDetectorIDs());
     opeventlist->setHistogram(m_histogram);
@@ -4528,8 +4682,8 @@ std::string EventList::splitByFullTimeMatrixSplitter(
   // Do nothing if there are no entries
   if (vecgroups.empty()) {
     // Copy all events to group workspace = -1
-    (*vec_outputEventList[-1]) = (*this);
-    // this->duplicate(outputs[-1]);
+    if (auto unfiltered = findSplitOutput(vec_outputEventList, -1))
+      *unfiltered = *this;
   } else {
     // Split
 
@@ -4831,6 +4985,10 @@ void getEventsFrom(const EventList &el,
 /** Helper function for the conversion to TOF. This handles the different
  *  event types.
  *
+ * The x values are copied out in blocks, so that each unit converts a whole
+ * block with a single call that can be vectorized rather than being called
+ * for every event.
+ *
  * @param events the list of events
  * @param fromUnit the unit to convert from
  * @param toUnit the unit to convert to
@@ -4839,13 +4997,19 @@ template <class T>
 void EventList::convertUnitsViaTofHelper(typename std::vector<T> &events,
                                          Mantid::Kernel::Unit *fromUnit,
                                          Mantid::Kernel::Unit *toUnit) {
-  auto itev = events.begin();
-  auto itev_end = events.end();
-  for (; itev != itev_end; itev++) {
-    // Conver to TOF
-    double tof = fromUnit->singleToTOF(itev->m_tof);
+  constexpr size_t BLOCK_SIZE = 1024;
+  std::array<double, BLOCK_SIZE> values;
+  for (size_t start = 0; start < events.size(); start += BLOCK_SIZE) {
+    const size_t count = std::min(BLOCK_SIZE, events.size() - start);
+    auto block = events.begin() + start;
+    for (size_t i = 0; i < count; ++i)
+      values[i] = block[i].m_tof;
+    // Convert to TOF
+    fromUnit->multipleToTOF(values.data(), count);
     // And back from TOF to whatever
-    itev->m_tof = toUnit->singleFromTOF(tof);
+    toUnit->multipleFromTOF(values.data(), count);
+    for (size_t i = 0; i < count; ++i)
+      block[i].m_tof = values[i];
   }
 }
 
@@ -0,0 +1,265 @@
+// Mantid Repository : https://github.com/mantidproject/mantid
+//
+// Copyright &copy; 2020 ISIS Rutherford Appleton Laboratory UKRI,
+//   NScD Oak Ridge National Laboratory, European Spallation Source,
+//   Institut Laue - Langevin & CSNS, Institute of High Energy Physics, CAS
+// SPDX - License - Identifier: GPL - 3.0 +
+#include "MantidDataObjects/EventRadixSort.h"
+
+#include "tbb/blocked_range.h"
+#include "tbb/parallel_for.h"
+#include "tbb/task_arena.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+
+using Mantid::Types::Event::TofEvent;
+
+namespace Mantid {
+namespace DataObjects {
+
+namespace {
+/// Number of key bits sorted in each pass
+constexpr unsigned DIGIT_BITS = 11;
+/// Number of distinct digit values
+constexpr std::size_t RADIX = std::size_t(1) << DIGIT_BITS;
+/// Mask selecting one digit
+constexpr uint64_t DIGIT_MASK = RADIX - 1;
+/// Number of passes needed to cover a 64 bit key
+constexpr unsigned NUM_PASSES = (64 + DIGIT_BITS - 1) / DIGIT_BITS;
+/// Sign bit of a 64 bit key
+constexpr uint64_t SIGN_BIT = uint64_t(1) << 63;
+/// Smallest block of events handed to one task by the parallel sort
+constexpr std::size_t MIN_BLOCK_EVENTS = 1 << 16;
+
+/// Key with the same ordering as the time-of-flight of an event
+struct TofKey {
+  template <class T> uint64_t operator()(const T &event) const {
+    const double tof = event.tof();
+    uint64_t bits;
+    std::memcpy(&bits, &tof, sizeof(bits));
+    // Flip every bit of negative numbers, and only the sign bit of the rest,
+    // so that the keys compare as unsigned integers in the same order as the
+    // doubles do.
+    return (bits & SIGN_BIT) ? ~bits : (bits | SIGN_BIT);
+  }
+};
+
+/// Key with the same ordering as the pulse time of an event
+struct PulseTimeKey {
+  template <class T> uint64_t operator()(const T &event) const {
+    return static_cast<uint64_t>(event.pulseTime().totalNanoseconds()) ^
+           SIGN_BIT;
+  }
+};
+
+/// @return the digit of a key sorted in the given pass
+inline std::size_t digit(const uint64_t key, const unsigned pass) {
+  return static_cast<std::size_t>((key >> (pass * DIGIT_BITS)) & DIGIT_MASK);
+}
+
+/** Find the passes that actually need doing: a digit that is the same in
+ * every key does not change the order.
+ * @param varying :: bits that differ between at least two keys
+ * @return the passes to perform, least significant first
+ */
+std::vector<unsigned> passesNeeded(const uint64_t varying) {
+  std::vector<unsigned> passes;
+  for (unsigned pass = 0; pass < NUM_PASSES; ++pass)
+    if (digit(varying, pass) != 0)
+      passes.emplace_back(pass);
+  return passes;
+}
+
+/** Sort in a single thread. The digit counts do not depend on the order of
+ * the events, so the counts for every pass are made in one read of the input.
+ * @param events :: the events to sort
+ * @param key :: functor giving the sort key of an event
+ */
+template <class T, class KeyFunc>
+void serialRadixSort(std::vector<T> &events, const KeyFunc &key) {
+  const std::size_t numEvents = events.size();
+  if (numEvents < 2)
+    return;
+
+  std::vector<std::size_t> counts(NUM_PASSES * RADIX, 0);
+  const uint64_t firstKey = key(events.front());
+  uint64_t varying = 0;
+  for (const auto &event : events) {
+    const uint64_t k = key(event);
+    varying |= k ^ firstKey;
+    for (unsigned pass = 0; pass < NUM_PASSES; ++pass)
+      ++counts[pass * RADIX + digit(k, pass)];
+  }
+  const auto passes = passesNeeded(varying);
+  if (passes.empty())
+    return;
+
+  std::vector<T> buffer(numEvents);
+  T *src = events.data();
+  T *dst = buffer.data();
+  for (const unsigned pass : passes) {
+    // Turn the counts into the position of the first event of each digit
+    std::size_t *offsets = &counts[pass * RADIX];
+    std::size_t total = 0;
+    for (std::size_t d = 0; d < RADIX; ++d) {
+      const std::size_t count = offsets[d];
+      offsets[d] = total;
+      total += count;
+    }
+    for (std::size_t i = 0; i < numEvents; ++i)
+      dst[offsets[digit(key(src[i]), pass)]++] = src[i];
+    std::swap(src, dst);
+  }
+  if (src != events.data())
+    events.swap(buffer);
+}
+
+/** Sort using several threads. The events are split into contiguous blocks;
+ * for each pass every block counts its digits, the counts are combined so
+ * that each block knows where its events go, and the blocks then scatter
+ * their events independently. Blocks keep their relative order, so the sort
+ * stays stable.
+ * @param events :: the events to sort
+ * @param key :: functor giving the sort key of an event
+ */
+template <class T, class KeyFunc>
+void parallelRadixSort(std::vector<T> &events, const KeyFunc &key) {
+  const std::size_t numEvents = events.size();
+  const auto numThreads =
+      static_cast<std::size_t>(tbb::this_task_arena::max_concurrency());
+  const std::size_t numBlocks =
+      std::min(numEvents / MIN_BLOCK_EVENTS, 4 * numThreads);
+  if (numBlocks < 2) {
+    serialRadixSort(events, key);
+    return;
+  }
+  const std::size_t blockSize = (numEvents + numBlocks - 1) / numBlocks;
+  const auto blockRange = [&](const std::size_t block) {
+    return std::make_pair(block * blockSize,
+                          std::min(numEvents, (block + 1) * blockSize));
+  };
+
+  // Find the digits that vary, one block per task
+  std::vector<uint64_t> blockVarying(numBlocks, 0);
+  const uint64_t firstKey = key(events.front());
+  tbb::parallel_for(tbb::blocked_range<std::size_t>(0, numBlocks, 1),
+                    [&](const tbb::blocked_range<std::size_t> &range) {
+                      for (auto block = range.begin(); block != range.end();
+                           ++block) {
+                        const auto bounds = blockRange(block);
+                        uint64_t varying = 0;
+                        for (auto i = bounds.first; i < bounds.second; ++i)
+                          varying |= key(events[i]) ^ firstKey;
+                        blockVarying[block] = varying;
+                      }
+                    });
+  uint64_t varying = 0;
+  for (const auto blockBits : blockVarying)
+    varying |= blockBits;
+  const auto passes = passesNeeded(varying);
+  if (passes.empty())
+    return;
+
+  std::vector<T> buffer(numEvents);
+  std::vector<std::size_t> offsets(numBlocks * RADIX);
+  T *src = events.data();
+  T *dst = buffer.data();
+  for (const unsigned pass : passes) {
+    tbb::parallel_for(tbb::blocked_range<std::size_t>(0, numBlocks, 1),
+                      [&](const tbb::blocked_range<std::size_t> &range) {
+                        for (auto block = range.begin(); block != range.end();
+                             ++block) {
+                          std::size_t *counts = &offsets[block * RADIX];
+                          std::fill(counts, counts + RADIX, 0);
+                          const auto bounds = blockRange(block);
+                          for (auto i = bounds.first; i < bounds.second; ++i)
+                            ++counts[digit(key(src[i]), pass)];
+                        }
+                      });
+
+    // Events with a lower digit come first, then those from earlier blocks
+    std::size_t total = 0;
+    for (std::size_t d = 0; d < RADIX; ++d) {
+      for (std::size_t block = 0; block < numBlocks; ++block) {
+        const std::size_t count = offsets[block * RADIX + d];
+        offsets[block * RADIX + d] = total;
+        total += count;
+      }
+    }
+
+    tbb::parallel_for(tbb::blocked_range<std::size_t>(0, numBlocks, 1),
+                      [&](const tbb::blocked_range<std::size_t> &range) {
+                        for (auto block = range.begin(); block != range.end();
+                             ++block) {
+                          std::size_t *blockOffsets = &offsets[block * RADIX];
+                          const auto bounds = blockRange(block);
+                          for (auto i = bounds.first; i < bounds.second; ++i)
+                            dst[blockOffsets[digit(key(src[i]), pass)]++] =
+                                src[i];
+                        }
+                      });
+    std::swap(src, dst);
+  }
+  if (src != events.data())
+    events.swap(buffer);
+}
+
+template <class T, class KeyFunc>
+void radixSort(std::vector<T> &events, const KeyFunc &key,
+               const bool parallel) {
+  if (parallel)
+    parallelRadixSort(events, key);
+  else
+    serialRadixSort(events, key);
+}
+} // namespace
+
+/** Sort events by time-of-flight
+ * @param events :: the events to sort
+ * @param parallel :: if true, use several threads
+ */
+void EventRadixSort::sortTof(std::vector<TofEvent> &events,
+                             const bool parallel) {
+  radixSort(events, TofKey(), parallel);
+}
+
+/** Sort weighted events by time-of-flight
+ * @param events :: the events to sort
+ * @param parallel :: if true, use several threads
+ */
+void EventRadixSort::sortTof(std::vector<WeightedEvent> &events,
+                             const bool parallel) {
+  radixSort(events, TofKey(), parallel);
+}
+
+/** Sort weighted events without time by time-of-flight
+ * @param events :: the events to sort
+ * @param parallel :: if true, use several threads
+ */
+void EventRadixSort::sortTof(std::vector<WeightedEventNoTime> &events,
+                             const bool parallel) {
+  radixSort(events, TofKey(), parallel);
+}
+
+/** Sort events by pulse time
+ * @param events :: the events to sort
+ * @param parallel :: if true, use several threads
+ */
+void EventRadixSort::sortPulseTime(std::vector<TofEvent> &events,
+                                   const bool parallel) {
+  radixSort(events, PulseTimeKey(), parallel);
+}
+
+/** Sort weighted events by pulse time
+ * @param events :: the events to sort
+ * @param parallel :: if true, use several threads
+ */
+void EventRadixSort::sortPulseTime(std::vector<WeightedEvent> &events,
+                                   const bool parallel) {
+  radixSort(events, PulseTimeKey(), parallel);
+}
+
+} // namespace DataObjects
+} // namespace Mantid
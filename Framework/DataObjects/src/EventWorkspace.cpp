@@ -460,6 +460,26 @@ bool EventWorkspace::isHistogramData() const { return true; }
  */
 size_t EventWorkspace::MRUSize() const { return mru->MRUSize(); }
 
+/** Check whether the MRU lists of every thread are empty.
+ * @return :: true if no histogram is cached.
+ */
+bool EventWorkspace::MRUEmpty() const { return mru->empty(); }
+
+/** Return how many histogram lookups were served from the MRU lists, since
+ * the workspace was created or the counters were last reset.
+ * @return :: number of hits.
+ */
+size_t EventWorkspace::MRUHits() const { return mru->hits(); }
+
+/** Return how many histogram lookups had to generate the histogram from the
+ * events, since the workspace was created or the counters were last reset.
+ * @return :: number of misses.
+ */
+size_t EventWorkspace::MRUMisses() const { return mru->misses(); }
+
+/** Reset the MRU hit and miss counters */
+void EventWorkspace::resetMRUCounters() const { mru->resetCounters(); }
+
 /** Clears the MRU lists */
 void EventWorkspace::clearMRU() const { mru->clear(); }
 
@@ -7,6 +7,8 @@
 #include "MantidDataObjects/EventWorkspaceMRU.h"
 #include "MantidKernel/System.h"
 
+#include <cmath>
+
 namespace Mantid {
 namespace DataObjects {
 
@@ -94,8 +96,11 @@ EventWorkspaceMRU::findY(size_t thread_num, const EventList *index) {
   Poco::ScopedReadRWLock _lock(m_changeMruListsMutexY);
   auto result = m_bufferedDataY[thread_num]->find(
       reinterpret_cast<std::uintptr_t>(index));
-  if (result)
+  if (result) {
+    m_hits.fetch_add(1, std::memory_order_relaxed);
     return result->m_data;
+  }
+  m_misses.fetch_add(1, std::memory_order_relaxed);
   return YType(nullptr);
 }
 
@@ -110,8 +115,11 @@ EventWorkspaceMRU::findE(size_t thread_num, const EventList *index) {
   Poco::ScopedReadRWLock _lock(m_changeMruListsMutexE);
   auto result = m_bufferedDataE[thread_num]->find(
       reinterpret_cast<std::uintptr_t>(index));
-  if (result)
+  if (result) {
+    m_hits.fetch_add(1, std::memory_order_relaxed);
     return result->m_data;
+  }
+  m_misses.fetch_add(1, std::memory_order_relaxed);
   return EType(nullptr);
 }
 
@@ -168,6 +176,103 @@ void EventWorkspaceMRU::deleteIndex(const EventList *index) {
   }
 }
 
+/** Check whether any of the MRU buffers hold data for the given index. This
+ * does not count towards the hit/miss statistics.
+ *
+ * @param index :: index to look for.
+ * @return true if a Y or E histogram is cached for the index.
+ */
+bool EventWorkspaceMRU::containsIndex(const EventList *index) const {
+  const auto marker = reinterpret_cast<std::uintptr_t>(index);
+  {
+    Poco::ScopedReadRWLock _lock1(m_changeMruListsMutexY);
+    for (const auto &data : m_bufferedDataY) {
+      if (data && data->find(marker))
+        return true;
+    }
+  }
+  Poco::ScopedReadRWLock _lock2(m_changeMruListsMutexE);
+  for (const auto &data : m_bufferedDataE) {
+    if (data && data->find(marker))
+      return true;
+  }
+  return false;
+}
+
+/** Check whether the MRU buffers of every thread are empty.
+ *
+ * @return true if no Y or E histogram is cached.
+ */
+bool EventWorkspaceMRU::empty() const {
+  {
+    Poco::ScopedReadRWLock _lock1(m_changeMruListsMutexY);
+    for (const auto &data : m_bufferedDataY) {
+      if (data && data->size() > 0)
+        return false;
+    }
+  }
+  Poco::ScopedReadRWLock _lock2(m_changeMruListsMutexE);
+  for (const auto &data : m_bufferedDataE) {
+    if (data && data->size() > 0)
+      return false;
+  }
+  return true;
+}
+
+/** Incrementally update the histograms cached for an index after events
+ * have been added to (or, with negative deltaY, subtracted from) its event
+ * list, instead of dropping them. The errors are combined in quadrature.
+ * Cached histograms whose size does not match the deltas are deleted.
+ *
+ * @param index :: index of the data to update.
+ * @param deltaY :: counts of the added events, binned as the cached data.
+ * @param deltaE :: errors of the added events, binned as the cached data.
+ */
+void EventWorkspaceMRU::addToIndex(const EventList *index,
+                                   const MantidVec &deltaY,
+                                   const MantidVec &deltaE) {
+  const auto marker = reinterpret_cast<std::uintptr_t>(index);
+  {
+    // Exclusive, because the cached cow_ptr is replaced in place
+    Poco::ScopedWriteRWLock _lock1(m_changeMruListsMutexY);
+    for (auto &data : m_bufferedDataY) {
+      if (!data)
+        continue;
+      auto entry = data->find(marker);
+      if (!entry)
+        continue;
+      if (!entry->m_data || entry->m_data->size() != deltaY.size()) {
+        data->deleteIndex(marker);
+        continue;
+      }
+      auto &y = entry->m_data.access();
+      for (size_t i = 0; i < y.size(); ++i)
+        y[i] += deltaY[i];
+    }
+  }
+  Poco::ScopedWriteRWLock _lock2(m_changeMruListsMutexE);
+  for (auto &data : m_bufferedDataE) {
+    if (!data)
+      continue;
+    auto entry = data->find(marker);
+    if (!entry)
+      continue;
+    if (!entry->m_data || entry->m_data->size() != deltaE.size()) {
+      data->deleteIndex(marker);
+      continue;
+    }
+    auto &e = entry->m_data.access();
+    for (size_t i = 0; i < e.size(); ++i)
+      e[i] = std::sqrt(e[i] * e[i] + deltaE[i] * deltaE[i]);
+  }
+}
+
+/// Reset the hit and miss counters to zero
+void EventWorkspaceMRU::resetCounters() {
+  m_hits.store(0, std::memory_order_relaxed);
+  m_misses.store(0, std::memory_order_relaxed);
+}
+
 size_t EventWorkspaceMRU::MRUSize() const {
   if (m_bufferedDataY.empty()) {
     return 0;
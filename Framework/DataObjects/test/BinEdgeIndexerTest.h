@@ -0,0 +1,115 @@
+// Mantid Repository : https://github.com/mantidproject/mantid
+//
+// Copyright &copy; 2020 ISIS Rutherford Appleton Laboratory UKRI,
+//   NScD Oak Ridge National Laboratory, European Spallation Source,
+//   Institut Laue - Langevin & CSNS, Institute of High Energy Physics, CAS
+// SPDX - License - Identifier: GPL - 3.0 +
+#pragma once
+
+#include "MantidDataObjects/BinEdgeIndexer.h"
+
+#include <cxxtest/TestSuite.h>
+
+#include <algorithm>
+#include <cmath>
+
+using Mantid::DataObjects::BinEdgeIndexer;
+
+class BinEdgeIndexerTest : public CxxTest::TestSuite {
+public:
+  // This pair of boilerplate methods prevent the suite being created statically
+  // This means the constructor isn't called when running other tests
+  static BinEdgeIndexerTest *createSuite() { return new BinEdgeIndexerTest(); }
+  static void destroySuite(BinEdgeIndexerTest *suite) { delete suite; }
+
+  void test_linear_edges_are_detected() {
+    const std::vector<double> edges{0., 0.5, 1., 1.5, 2.};
+    BinEdgeIndexer indexer(edges);
+    TS_ASSERT_EQUALS(indexer.spacing(), BinEdgeIndexer::Spacing::Linear);
+    TS_ASSERT(indexer.isClosedForm());
+    TS_ASSERT_EQUALS(indexer.numberOfBins(), 4);
+  }
+
+  void test_logarithmic_edges_are_detected() {
+    const std::vector<double> edges{1., 2., 4., 8., 16.};
+    BinEdgeIndexer indexer(edges);
+    TS_ASSERT_EQUALS(indexer.spacing(), BinEdgeIndexer::Spacing::Logarithmic);
+    TS_ASSERT(indexer.isClosedForm());
+  }
+
+  void test_irregular_edges_are_arbitrary() {
+    const std::vector<double> edges{0., 1., 5., 7., 100.};
+    BinEdgeIndexer indexer(edges);
+    TS_ASSERT_EQUALS(indexer.spacing(), BinEdgeIndexer::Spacing::Arbitrary);
+    TS_ASSERT(!indexer.isClosedForm());
+  }
+
+  void test_too_few_edges() {
+    const std::vector<double> edges{1.};
+    BinEdgeIndexer indexer(edges);
+    TS_ASSERT_EQUALS(indexer.numberOfBins(), 0);
+    TS_ASSERT_EQUALS(indexer.index(1.), BinEdgeIndexer::npos);
+  }
+
+  void test_values_on_edges_and_outside() {
+    const std::vector<double> edges{0., 0.5, 1., 1.5, 2.};
+    BinEdgeIndexer indexer(edges);
+    TS_ASSERT_EQUALS(indexer.index(-0.1), BinEdgeIndexer::npos);
+    TS_ASSERT_EQUALS(indexer.index(0.), 0);
+    TS_ASSERT_EQUALS(indexer.index(0.5), 1);
+    TS_ASSERT_EQUALS(indexer.index(1.99), 3);
+    // The last edge is excluded, as in EventList::generateHistogram
+    TS_ASSERT_EQUALS(indexer.index(2.), BinEdgeIndexer::npos);
+  }
+
+  void test_linear_matches_binary_search() {
+    std::vector<double> edges;
+    // Accumulate the edges as Rebin does, so they are not exactly regular
+    for (double x = 0.; x < 1000.; x += 0.1)
+      edges.emplace_back(x);
+    checkAgainstBinarySearch(edges, BinEdgeIndexer::Spacing::Linear);
+  }
+
+  void test_logarithmic_matches_binary_search() {
+    std::vector<double> edges;
+    for (double x = 10.; x < 20000.; x *= 1.001)
+      edges.emplace_back(x);
+    checkAgainstBinarySearch(edges, BinEdgeIndexer::Spacing::Logarithmic);
+  }
+
+  void test_arbitrary_matches_binary_search() {
+    const std::vector<double> edges{0., 1., 5., 7., 100., 1000., 15000.};
+    checkAgainstBinarySearch(edges, BinEdgeIndexer::Spacing::Arbitrary);
+  }
+
+private:
+  void checkAgainstBinarySearch(const std::vector<double> &edges,
+                                BinEdgeIndexer::Spacing expected) {
+    BinEdgeIndexer indexer(edges);
+    TS_ASSERT_EQUALS(indexer.spacing(), expected);
+
+    // Every edge, values just either side of it, and a spread of values
+    std::vector<double> values;
+    for (const double edge : edges) {
+      values.emplace_back(edge);
+      values.emplace_back(std::nextafter(edge, -1e300));
+      values.emplace_back(std::nextafter(edge, 1e300));
+    }
+    for (size_t i = 0; i < 10000; ++i)
+      values.emplace_back(-10. + 2. * edges.back() *
+                                     static_cast<double>((i * 7919) % 10000) /
+                                     10000.);
+
+    std::vector<size_t> bins(values.size());
+    indexer.indices(values.data(), values.size(), bins.data());
+    for (size_t i = 0; i < values.size(); ++i) {
+      const double x = values[i];
+      size_t expectedBin = BinEdgeIndexer::npos;
+      if (x >= edges.front() && x < edges.back())
+        expectedBin = std::upper_bound(edges.cbegin(), edges.cend(), x) -
+                      edges.cbegin() - 1;
+      TS_ASSERT_EQUALS(bins[i], expectedBin);
+      TS_ASSERT_EQUALS(indexer.index(x), expectedBin);
+    }
+  }
+};
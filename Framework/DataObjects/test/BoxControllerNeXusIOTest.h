@@ -10,8 +10,10 @@
 #include "MantidDataObjects/BoxControllerNeXusIO.h"
 #include "MantidTestHelpers/MDEventsTestHelper.h"
 
+#include <algorithm>
 #include <map>
 #include <memory>
+#include <numeric>
 
 #include <cxxtest/TestSuite.h>
 
@@ -233,6 +235,102 @@ public:
 
   void test_WriteFloatReadDouble() { this->WriteReadRead<float, double>(); }
 
+  void test_sequential_reads_are_served_by_the_page_cache() {
+    using Mantid::DataObjects::BoxControllerNeXusIO;
+
+    std::unique_ptr<BoxControllerNeXusIO> pSaver(createTestBoxController());
+    pSaver->setDataType(sizeof(float), "MDEvent");
+    const size_t nColumns = pSaver->getNDataColums();
+    // pages of 100 events, room for 8 of them and read 2 ahead
+    pSaver->setPageCache(100, 800 * nColumns * sizeof(float), 2);
+
+    const size_t nEvents = 1000;
+    std::vector<float> toWrite(nEvents * nColumns);
+    std::iota(toWrite.begin(), toWrite.end(), 0.f);
+    TS_ASSERT_THROWS_NOTHING(pSaver->openFile(this->xxfFileName, "w"));
+    const std::string FullPathFile = pSaver->getFileName();
+    pSaver->saveBlock(toWrite, 0);
+    pSaver->closeFile();
+
+    TS_ASSERT_THROWS_NOTHING(pSaver->openFile(FullPathFile, "r"));
+    std::vector<float> toRead;
+    for (size_t start = 0; start < nEvents; start += 30) {
+      const size_t n = std::min<size_t>(30, nEvents - start);
+      TS_ASSERT_THROWS_NOTHING(pSaver->loadBlock(toRead, start, n));
+      TS_ASSERT_EQUALS(toRead.size(), n * nColumns);
+      TS_ASSERT(std::equal(toRead.begin(), toRead.end(),
+                           toWrite.begin() + start * nColumns));
+    }
+    const auto statistics = pSaver->getPageCacheStatistics();
+    // every page is read from the file once, most of them ahead of time
+    TS_ASSERT_EQUALS(statistics.pagesRead, 10);
+    TS_ASSERT_EQUALS(statistics.bytesRead, toWrite.size() * sizeof(float));
+    TS_ASSERT(statistics.hitRate() > 0.5);
+    pSaver->closeFile();
+
+    if (Poco::File(FullPathFile).exists())
+      Poco::File(FullPathFile).remove();
+  }
+
+  void test_writes_replace_cached_pages() {
+    using Mantid::DataObjects::BoxControllerNeXusIO;
+
+    std::unique_ptr<BoxControllerNeXusIO> pSaver(createTestBoxController());
+    pSaver->setDataType(sizeof(float), "MDEvent");
+    const size_t nColumns = pSaver->getNDataColums();
+    pSaver->setPageCache(100, 800 * nColumns * sizeof(float), 2);
+
+    std::vector<float> toWrite(150 * nColumns);
+    std::iota(toWrite.begin(), toWrite.end(), 0.f);
+    TS_ASSERT_THROWS_NOTHING(pSaver->openFile(this->xxfFileName, "w"));
+    const std::string FullPathFile = pSaver->getFileName();
+    pSaver->saveBlock(toWrite, 0);
+
+    std::vector<float> toRead;
+    pSaver->loadBlock(toRead, 0, 150);
+    TS_ASSERT_EQUALS(toRead, toWrite);
+
+    // overwrite events within the first page and grow the short last one
+    std::vector<float> update(20 * nColumns, -1.f);
+    pSaver->saveBlock(update, 10);
+    pSaver->saveBlock(update, 150);
+    std::copy(update.begin(), update.end(), toWrite.begin() + 10 * nColumns);
+    toWrite.insert(toWrite.end(), update.begin(), update.end());
+
+    pSaver->loadBlock(toRead, 0, 170);
+    TS_ASSERT_EQUALS(toRead, toWrite);
+    pSaver->closeFile();
+
+    if (Poco::File(FullPathFile).exists())
+      Poco::File(FullPathFile).remove();
+  }
+
+  void test_disabled_page_cache_reads_straight_from_the_file() {
+    using Mantid::DataObjects::BoxControllerNeXusIO;
+
+    std::unique_ptr<BoxControllerNeXusIO> pSaver(createTestBoxController());
+    pSaver->setDataType(sizeof(float), "MDEvent");
+    pSaver->setPageCache(0, 0, 0);
+    const size_t nColumns = pSaver->getNDataColums();
+
+    std::vector<float> toWrite(50 * nColumns);
+    std::iota(toWrite.begin(), toWrite.end(), 0.f);
+    TS_ASSERT_THROWS_NOTHING(pSaver->openFile(this->xxfFileName, "w"));
+    const std::string FullPathFile = pSaver->getFileName();
+    pSaver->saveBlock(toWrite, 0);
+
+    std::vector<float> toRead;
+    pSaver->loadBlock(toRead, 0, 50);
+    TS_ASSERT_EQUALS(toRead, toWrite);
+    const auto statistics = pSaver->getPageCacheStatistics();
+    TS_ASSERT_EQUALS(statistics.hits + statistics.misses, 0);
+    TS_ASSERT_EQUALS(statistics.pagesRead, 0);
+    pSaver->closeFile();
+
+    if (Poco::File(FullPathFile).exists())
+      Poco::File(FullPathFile).remove();
+  }
+
 private:
   /// Create a test box controller. Ownership is passed to the caller
   Mantid::DataObjects::BoxControllerNeXusIO *createTestBoxController() {
@@ -8,6 +8,7 @@
 
 #include "MantidAPI/FrameworkManager.h"
 #include "MantidDataObjects/EventList.h"
+#include "MantidDataObjects/EventRadixSort.h"
 #include "MantidDataObjects/EventWorkspace.h"
 #include "MantidDataObjects/Histogram1D.h"
 #include "MantidKernel/CPUTimer.h"
@@ -1237,6 +1238,57 @@ public:
     TS_ASSERT_EQUALS(this->el.ptrX()->size(), NUMBINS + 1);
   }
 
+  void test_histogram_unsorted_regular_bins_does_not_sort() {
+    this->fake_data();
+    EventList sorted(el);
+    sorted.sortTof();
+
+    std::vector<MantidVec> binnings{this->makeX(1.e6), MantidVec{}};
+    // Logarithmic bins
+    for (double tof = 100.; tof < MAX_TOF; tof *= 1.1)
+      binnings.back().emplace_back(tof);
+
+    for (const auto &X : binnings) {
+      MantidVec Y, E, sortedY, sortedE;
+      el.generateHistogram(X, Y, E);
+      TS_ASSERT_EQUALS(el.getSortType(), UNSORTED);
+      sorted.generateHistogram(X, sortedY, sortedE);
+      TS_ASSERT_EQUALS(Y, sortedY);
+      TS_ASSERT_EQUALS(E, sortedE);
+    }
+  }
+
+  void test_histogram_unsorted_regular_bins_skip_error() {
+    this->fake_data();
+    const MantidVec X = this->makeX(1.e6);
+    MantidVec Y, E;
+    el.generateHistogram(X, Y, E, true);
+    TS_ASSERT_EQUALS(el.getSortType(), UNSORTED);
+    TS_ASSERT_EQUALS(Y.size(), X.size() - 1);
+    TS_ASSERT(E.empty());
+  }
+
+  void test_histogram_unsorted_regular_bins_sorts_weighted_events() {
+    // Weights are summed in tof order, as before
+    for (int this_type = 1; this_type < 3; this_type++) {
+      this->fake_data();
+      el.switchTo(static_cast<EventType>(this_type));
+      el *= 1.5;
+      MantidVec Y, E;
+      el.generateHistogram(this->makeX(1.e6), Y, E);
+      TSM_ASSERT_EQUALS(this_type, el.getSortType(), TOF_SORT);
+    }
+  }
+
+  void test_histogram_unsorted_irregular_bins_sorts() {
+    this->fake_data();
+    MantidVec X{0., 10., 1000., 1.e5, 1.e6, 1.e7};
+    MantidVec Y, E;
+    el.generateHistogram(X, Y, E);
+    TS_ASSERT_EQUALS(el.getSortType(), TOF_SORT);
+    TS_ASSERT_EQUALS(Y.size(), 5);
+  }
+
   //  void test_histogram_static_function()
   //  {
   //    std::vector<WeightedEvent> events;
@@ -1482,6 +1534,27 @@ public:
     TS_ASSERT_THROWS_ANYTHING(el.convertUnitsViaTof(&fromUnit, &toUnit));
   }
 
+  //-----------------------------------------------------------------------------------------------
+  void test_convertUnitsViaTof_matches_single_conversions() {
+    Mantid::Kernel::Units::Wavelength fromUnit;
+    Mantid::Kernel::Units::dSpacing toUnit;
+    fromUnit.initialize(10.0, 1.5, 1.2, 0, 0.0, 0.0);
+    toUnit.initialize(10.0, 1.5, 1.2, 0, 0.0, 0.0);
+    // More events than are converted in one block
+    el.clear();
+    for (int i = 0; i < 2500; ++i)
+      el += TofEvent(0.01 * i, i);
+    const auto original = el.getEvents();
+    el.convertUnitsViaTof(&fromUnit, &toUnit);
+    TS_ASSERT_EQUALS(el.getNumberEvents(), original.size());
+    for (size_t i = 0; i < original.size(); ++i) {
+      const double expected =
+          toUnit.singleFromTOF(fromUnit.singleToTOF(original[i].tof()));
+      TS_ASSERT_EQUALS(el.getEvent(i).tof(), expected);
+      TS_ASSERT_EQUALS(el.getEvent(i).pulseTime(), original[i].pulseTime());
+    }
+  }
+
   //-----------------------------------------------------------------------------------------------
   void test_convertUnitsViaTof_allTypes() {
     DummyUnit1 fromUnit;
@@ -1964,6 +2037,80 @@ public:
     return;
   }
 
+  /** Outputs are sized once from a count of their events, so they hold no
+   * spare capacity and those receiving no events allocate nothing
+   */
+  void test_splitByFullTime_allocates_outputs_once() {
+    fake_uniform_time_sns_data();
+
+    std::map<int, EventList *> outputs;
+    for (int i = -1; i < 10; i++)
+      outputs.emplace(i, new EventList());
+
+    TimeSplitterType split;
+    for (int i = 1; i < 10; i++) {
+      if ((i % 2) == 0)
+        split.emplace_back(SplittingInterval(i * 100000000,
+                                             (i + 1) * 100000000, i));
+    }
+    el.splitByFullTime(split, outputs, false, 1.0, 0.0);
+
+    size_t total = 0;
+    for (const auto &output : outputs) {
+      const auto &events = output.second->getEvents();
+      total += events.size();
+      TS_ASSERT_EQUALS(events.capacity(), events.size());
+      if ((output.first % 2) == 0 && output.first > 0) {
+        TS_ASSERT_EQUALS(events.size(), 100);
+        TS_ASSERT_EQUALS(output.second->getSortType(), PULSETIMETOF_SORT);
+      } else if (output.first != -1) {
+        TS_ASSERT_EQUALS(events.size(), 0);
+      }
+    }
+    // Events before 200 and between the splitters go to -1, the rest are
+    // dropped
+    TS_ASSERT_EQUALS(outputs[-1]->getNumberEvents(), 500);
+    TS_ASSERT_EQUALS(total, 900);
+
+    for (auto &output : outputs)
+      delete output.second;
+  }
+
+  /** Splitting a list large enough to fill the outputs in parallel, with
+   * both the sparse and the dense vector splitters
+   */
+  void test_splitByFullTimeMatrixSplitter_large_list() {
+    const size_t numEvents = EventRadixSort::MIN_PARALLEL_EVENTS;
+    el = EventList();
+    el.reserve(numEvents);
+    for (size_t i = 0; i < numEvents; i++)
+      el += TofEvent(0.0013, static_cast<int64_t>(i * 10));
+
+    // Sparse: a splitter every 1000 events, cycling through 5 targets
+    std::vector<int64_t> sparseTimes;
+    std::vector<int> sparseGroups;
+    for (int64_t t = 5005; t < static_cast<int64_t>(numEvents * 10);
+         t += 10000) {
+      sparseTimes.emplace_back(t);
+      sparseGroups.emplace_back(static_cast<int>(sparseGroups.size() % 5));
+    }
+    sparseGroups.pop_back();
+    checkMatrixSplit(sparseTimes, sparseGroups);
+
+    // Dense: more splitter times than events
+    el = EventList();
+    for (size_t i = 0; i < 1000; i++)
+      el += TofEvent(0.0013, static_cast<int64_t>(i * 10));
+    std::vector<int64_t> denseTimes;
+    std::vector<int> denseGroups;
+    for (int64_t t = 100; t < 20000; t += 5) {
+      denseTimes.emplace_back(t);
+      denseGroups.emplace_back(static_cast<int>(denseGroups.size() % 3));
+    }
+    denseGroups.pop_back();
+    checkMatrixSplit(denseTimes, denseGroups);
+  }
+
   //-----------------------------------------------------------------------------------------------
   void test_splitByTime_allTypes() {
     // Go through each possible EventType as the input
@@ -2237,6 +2384,15 @@ public:
     TS_ASSERT_DELTA(el_weight_output.integrate(XMIN, XMAX, true), 2., .0001);
   }
 
+  void test_compressFatEvents_all_events_before_start_time() {
+    this->fake_uniform_data_weights(WEIGHTED);
+    EventList el_output;
+    TS_ASSERT_THROWS_NOTHING(el.compressFatEvents(
+        20000., el.getPulseTimeMax() + 1.0, 5., &el_output));
+    TS_ASSERT_EQUALS(el_output.getNumberEvents(), 0);
+    TS_ASSERT_EQUALS(el_output.getEventType(), WEIGHTED);
+  }
+
   void test_compressWeightedEvents() {
     this->fake_uniform_data_weights(WEIGHTED);
     EventList uniformOut;
@@ -2683,6 +2839,35 @@ public:
     }
   }
 
+  /** Split el with a matrix splitter and compare each output with the
+   * events expected for its group
+   */
+  void checkMatrixSplit(const std::vector<int64_t> &times,
+                        const std::vector<int> &groups) {
+    std::map<int, EventList *> outputs;
+    for (int i = -1; i < 5; i++)
+      outputs.emplace(i, new EventList());
+    el.splitByFullTimeMatrixSplitter(times, groups, outputs, false, 1.0, 0.0);
+
+    const bool sparse = times.size() < el.getNumberEvents();
+    std::map<int, std::vector<TofEvent>> expected;
+    for (const auto &event : el.getEvents()) {
+      const int64_t fullTime = event.pulseTime().totalNanoseconds() +
+                               static_cast<int64_t>(event.tof() * 1000);
+      const auto index = std::upper_bound(times.cbegin(), times.cend(),
+                                          fullTime) -
+                         times.cbegin();
+      if (index > 0 && index < static_cast<long>(times.size()))
+        expected[groups[index - 1]].emplace_back(event);
+      else if (!sparse)
+        expected[-1].emplace_back(event);
+    }
+    for (const auto &output : outputs) {
+      TS_ASSERT_EQUALS(output.second->getEvents(), expected[output.first]);
+      delete output.second;
+    }
+  }
+
   //----------------------------------------------------------------------------------------------
   /** Fake uniform time data more close to SNS case
    */
@@ -2909,6 +3094,10 @@ public:
                                           rand() % 1000, 2.34, 4.56);
     el_sorted_weighted.setSortOrder(TOF_SORT);
 
+    // 2 million events, one every 50 ns
+    for (size_t i = 0; i < 2000000; i++)
+      el_pulse_sorted += TofEvent(100.0, static_cast<int64_t>(i * 50));
+
     // A vector for histogramming, 100,000 steps of 1.0
     for (double i = 0; i < 100000; i += 1.0)
       fineX.emplace_back(i);
@@ -2924,7 +3113,7 @@ public:
   }
 
   EventList el_random, el_random_source, el_sorted, el_sorted_original,
-      el_sorted_weighted, el4, el5;
+      el_sorted_weighted, el_pulse_sorted, el4, el5;
   MantidVec fineX;
   MantidVec coarseX;
 
@@ -2940,6 +3129,22 @@ public:
 
   void tearDown() override {}
 
+  void test_splitByFullTimeMatrixSplitter_10000_targets() {
+    std::vector<int64_t> times;
+    std::vector<int> groups;
+    for (int64_t t = 0; t <= 100000000; t += 10000) {
+      times.emplace_back(t);
+      groups.emplace_back(static_cast<int>(groups.size()));
+    }
+    groups.pop_back();
+    std::map<int, EventList *> outputs;
+    std::vector<EventList> lists(groups.size() + 1);
+    for (size_t i = 0; i < lists.size(); ++i)
+      outputs.emplace(static_cast<int>(i) - 1, &lists[i]);
+    el_pulse_sorted.splitByFullTimeMatrixSplitter(times, groups, outputs,
+                                                  false, 1.0, 0.0);
+  }
+
   void test_sort_tof() { el_random.sortTof(); }
 
   void test_compressEvents() {
@@ -2956,6 +3161,14 @@ public:
 
   void test_convertTof() { el_random.convertTof(2.5, 6.78); }
 
+  void test_convertUnitsViaTof_dSpacing() {
+    Mantid::Kernel::Units::TOF fromUnit;
+    Mantid::Kernel::Units::dSpacing toUnit;
+    fromUnit.initialize(10.0, 1.5, 1.2, 0, 0.0, 0.0);
+    toUnit.initialize(10.0, 1.5, 1.2, 0, 0.0, 0.0);
+    el_random.convertUnitsViaTof(&fromUnit, &toUnit);
+  }
+
   void test_getTofs_setTofs() {
     std::vector<double> tofs;
     el_random.getTofs(tofs);
@@ -0,0 +1,225 @@
+// Mantid Repository : https://github.com/mantidproject/mantid
+//
+// Copyright &copy; 2020 ISIS Rutherford Appleton Laboratory UKRI,
+//   NScD Oak Ridge National Laboratory, European Spallation Source,
+//   Institut Laue - Langevin & CSNS, Institute of High Energy Physics, CAS
+// SPDX - License - Identifier: GPL - 3.0 +
+#pragma once
+
+#include "MantidDataObjects/EventRadixSort.h"
+
+#include <cxxtest/TestSuite.h>
+
+#include "tbb/parallel_sort.h"
+
+#include <algorithm>
+#include <random>
+
+using namespace Mantid::DataObjects;
+using Mantid::Types::Event::TofEvent;
+
+namespace {
+/// Events with repeated tofs and pulse times, including negative tofs
+template <class T> std::vector<T> createEvents(const size_t numEvents) {
+  std::mt19937 rng(1234);
+  std::uniform_int_distribution<int> tofs(-5000, 20000);
+  std::uniform_int_distribution<int64_t> pulses(0, 100000);
+  std::vector<T> events;
+  events.reserve(numEvents);
+  for (size_t i = 0; i < numEvents; ++i) {
+    const double tof = 0.25 * tofs(rng);
+    const int64_t pulse = 1000000000000000000 + 16666667 * pulses(rng);
+    // The weights record the original position, to check stability
+    events.emplace_back(
+        T(tof, pulse, static_cast<double>(i), static_cast<double>(i)));
+  }
+  return events;
+}
+
+template <>
+std::vector<TofEvent> createEvents<TofEvent>(const size_t numEvents) {
+  std::vector<TofEvent> events;
+  for (const auto &event : createEvents<WeightedEvent>(numEvents))
+    events.emplace_back(event.tof(), event.pulseTime());
+  return events;
+}
+
+template <>
+std::vector<WeightedEventNoTime>
+createEvents<WeightedEventNoTime>(const size_t numEvents) {
+  std::vector<WeightedEventNoTime> events;
+  for (const auto &event : createEvents<WeightedEvent>(numEvents))
+    events.emplace_back(event.tof(), event.weight(), event.errorSquared());
+  return events;
+}
+
+template <class T> bool tofLess(const T &lhs, const T &rhs) {
+  return lhs.tof() < rhs.tof();
+}
+
+template <class T> bool pulseTimeLess(const T &lhs, const T &rhs) {
+  return lhs.pulseTime() < rhs.pulseTime();
+}
+} // namespace
+
+class EventRadixSortTest : public CxxTest::TestSuite {
+public:
+  // This pair of boilerplate methods prevent the suite being created statically
+  // This means the constructor isn't called when running other tests
+  static EventRadixSortTest *createSuite() { return new EventRadixSortTest(); }
+  static void destroySuite(EventRadixSortTest *suite) { delete suite; }
+
+  void test_empty_and_single_event() {
+    std::vector<TofEvent> events;
+    TS_ASSERT_THROWS_NOTHING(EventRadixSort::sortTof(events));
+    events.emplace_back(1.0, 2);
+    EventRadixSort::sortTof(events);
+    TS_ASSERT_EQUALS(events, std::vector<TofEvent>{TofEvent(1.0, 2)});
+  }
+
+  void test_sortTof_handles_negative_and_equal_tofs() {
+    std::vector<TofEvent> events{TofEvent(3.5, 0), TofEvent(-1.5, 1),
+                                 TofEvent(1e9, 2), TofEvent(-1e9, 3),
+                                 TofEvent(3.5, 4), TofEvent(0.0, 5)};
+    EventRadixSort::sortTof(events);
+    const std::vector<TofEvent> expected{
+        TofEvent(-1e9, 3), TofEvent(-1.5, 1), TofEvent(0.0, 5),
+        TofEvent(3.5, 0),  TofEvent(3.5, 4),  TofEvent(1e9, 2)};
+    TS_ASSERT_EQUALS(events, expected);
+  }
+
+  void test_identical_keys_keep_order() {
+    std::vector<WeightedEvent> events;
+    for (size_t i = 0; i < 100; ++i)
+      events.emplace_back(5.0, 10, static_cast<double>(i), 1.0);
+    const auto original = events;
+    EventRadixSort::sortTof(events);
+    TS_ASSERT_EQUALS(events, original);
+    EventRadixSort::sortPulseTime(events);
+    TS_ASSERT_EQUALS(events, original);
+  }
+
+  void test_sortTof_matches_stable_sort() {
+    checkSortTof<TofEvent>(10000, false);
+    checkSortTof<WeightedEvent>(10000, false);
+    checkSortTof<WeightedEventNoTime>(10000, false);
+  }
+
+  void test_parallel_sortTof_matches_stable_sort() {
+    checkSortTof<TofEvent>(500000, true);
+    checkSortTof<WeightedEvent>(500000, true);
+    checkSortTof<WeightedEventNoTime>(500000, true);
+  }
+
+  void test_sortPulseTime_matches_stable_sort() {
+    checkSortPulseTime<TofEvent>(10000, false);
+    checkSortPulseTime<WeightedEvent>(10000, false);
+  }
+
+  void test_parallel_sortPulseTime_matches_stable_sort() {
+    checkSortPulseTime<TofEvent>(500000, true);
+    checkSortPulseTime<WeightedEvent>(500000, true);
+  }
+
+private:
+  template <class T>
+  void checkSortTof(const size_t numEvents, const bool parallel) {
+    auto events = createEvents<T>(numEvents);
+    auto expected = events;
+    std::stable_sort(expected.begin(), expected.end(), tofLess<T>);
+    EventRadixSort::sortTof(events, parallel);
+    TS_ASSERT(events == expected);
+  }
+
+  template <class T>
+  void checkSortPulseTime(const size_t numEvents, const bool parallel) {
+    auto events = createEvents<T>(numEvents);
+    auto expected = events;
+    std::stable_sort(expected.begin(), expected.end(), pulseTimeLess<T>);
+    EventRadixSort::sortPulseTime(events, parallel);
+    TS_ASSERT(events == expected);
+  }
+};
+
+class EventRadixSortTestPerformance : public CxxTest::TestSuite {
+public:
+  // This pair of boilerplate methods prevent the suite being created statically
+  // This means the constructor isn't called when running other tests
+  static EventRadixSortTestPerformance *createSuite() {
+    return new EventRadixSortTestPerformance();
+  }
+  static void destroySuite(EventRadixSortTestPerformance *suite) {
+    delete suite;
+  }
+
+  EventRadixSortTestPerformance()
+      : m_tofEvents(createEvents<TofEvent>(NUM_EVENTS)),
+        m_weightedEvents(createEvents<WeightedEvent>(NUM_EVENTS)),
+        m_noTimeEvents(createEvents<WeightedEventNoTime>(NUM_EVENTS)) {}
+
+  void test_sortTof_TofEvent_comparison() {
+    auto events = m_tofEvents;
+    tbb::parallel_sort(events.begin(), events.end());
+  }
+
+  void test_sortTof_TofEvent_radix() {
+    auto events = m_tofEvents;
+    EventRadixSort::sortTof(events);
+  }
+
+  void test_sortTof_TofEvent_parallel_radix() {
+    auto events = m_tofEvents;
+    EventRadixSort::sortTof(events, true);
+  }
+
+  void test_sortTof_WeightedEvent_comparison() {
+    auto events = m_weightedEvents;
+    tbb::parallel_sort(events.begin(), events.end());
+  }
+
+  void test_sortTof_WeightedEvent_radix() {
+    auto events = m_weightedEvents;
+    EventRadixSort::sortTof(events);
+  }
+
+  void test_sortTof_WeightedEvent_parallel_radix() {
+    auto events = m_weightedEvents;
+    EventRadixSort::sortTof(events, true);
+  }
+
+  void test_sortTof_WeightedEventNoTime_comparison() {
+    auto events = m_noTimeEvents;
+    tbb::parallel_sort(events.begin(), events.end());
+  }
+
+  void test_sortTof_WeightedEventNoTime_radix() {
+    auto events = m_noTimeEvents;
+    EventRadixSort::sortTof(events);
+  }
+
+  void test_sortTof_WeightedEventNoTime_parallel_radix() {
+    auto events = m_noTimeEvents;
+    EventRadixSort::sortTof(events, true);
+  }
+
+  void test_sortPulseTime_TofEvent_comparison() {
+    auto events = m_tofEvents;
+    tbb::parallel_sort(events.begin(), events.end(), pulseTimeLess<TofEvent>);
+  }
+
+  void test_sortPulseTime_TofEvent_radix() {
+    auto events = m_tofEvents;
+    EventRadixSort::sortPulseTime(events);
+  }
+
+  void test_sortPulseTime_TofEvent_parallel_radix() {
+    auto events = m_tofEvents;
+    EventRadixSort::sortPulseTime(events, true);
+  }
+
+private:
+  static constexpr size_t NUM_EVENTS = 10000000;
+  const std::vector<TofEvent> m_tofEvents;
+  const std::vector<WeightedEvent> m_weightedEvents;
+  const std::vector<WeightedEventNoTime> m_noTimeEvents;
+};
@@ -8,11 +8,14 @@
 
 #include "MantidKernel/System.h"
 #include "MantidKernel/Timer.h"
+#include "MantidKernel/make_cow.h"
 #include <cxxtest/TestSuite.h>
 
 #include "MantidDataObjects/EventWorkspaceMRU.h"
 
 using namespace Mantid::DataObjects;
+using Mantid::HistogramData::HistogramE;
+using Mantid::HistogramData::HistogramY;
 
 class EventWorkspaceMRUTest : public CxxTest::TestSuite {
 public:
@@ -21,4 +24,54 @@ public:
     TS_ASSERT_THROWS_NOTHING(mru.MRUSize());
     TS_ASSERT_EQUALS(mru.MRUSize(), 0);
   }
+
+  void test_hits_and_misses_are_counted() {
+    EventWorkspaceMRU mru;
+    const int dummy = 0;
+    const auto *index = reinterpret_cast<const EventList *>(&dummy);
+    mru.ensureEnoughBuffersY(0);
+    TS_ASSERT(!mru.findY(0, index));
+    TS_ASSERT_EQUALS(mru.misses(), 1);
+    mru.insertY(0, Mantid::Kernel::make_cow<HistogramY>(2, 1.0), index);
+    TS_ASSERT(mru.findY(0, index));
+    TS_ASSERT_EQUALS(mru.hits(), 1);
+    mru.resetCounters();
+    TS_ASSERT_EQUALS(mru.hits(), 0);
+    TS_ASSERT_EQUALS(mru.misses(), 0);
+  }
+
+  void test_addToIndex_updates_cached_histograms() {
+    EventWorkspaceMRU mru;
+    const int dummy = 0;
+    const auto *index = reinterpret_cast<const EventList *>(&dummy);
+    TS_ASSERT(!mru.containsIndex(index));
+    mru.ensureEnoughBuffersY(0);
+    mru.ensureEnoughBuffersE(0);
+    TS_ASSERT(mru.empty());
+    const auto y = Mantid::Kernel::make_cow<HistogramY>(2, 4.0);
+    mru.insertY(0, y, index);
+    mru.insertE(0, Mantid::Kernel::make_cow<HistogramE>(2, 3.0), index);
+    TS_ASSERT(mru.containsIndex(index));
+    TS_ASSERT(!mru.empty());
+
+    mru.addToIndex(index, {1.0, -2.0}, {4.0, 0.0});
+    TS_ASSERT_EQUALS(mru.findY(0, index)->rawData(),
+                     std::vector<double>({5.0, 2.0}));
+    TS_ASSERT_EQUALS(mru.findE(0, index)->rawData(),
+                     std::vector<double>({5.0, 3.0}));
+    // Data handed out before the update is not changed
+    TS_ASSERT_EQUALS(y->rawData(), std::vector<double>(2, 4.0));
+  }
+
+  void test_addToIndex_deletes_histograms_of_different_size() {
+    EventWorkspaceMRU mru;
+    const int dummy = 0;
+    const auto *index = reinterpret_cast<const EventList *>(&dummy);
+    mru.ensureEnoughBuffersY(0);
+    mru.ensureEnoughBuffersE(0);
+    mru.insertY(0, Mantid::Kernel::make_cow<HistogramY>(2, 4.0), index);
+    mru.insertE(0, Mantid::Kernel::make_cow<HistogramE>(2, 2.0), index);
+    mru.addToIndex(index, {1.0, 1.0, 1.0}, {1.0, 1.0, 1.0});
+    TS_ASSERT(!mru.containsIndex(index));
+  }
 };
@@ -806,6 +806,37 @@ public:
     TS_ASSERT_EQUALS(y.use_count(), 1);
   }
 
+  void test_addToCachedHistogram_updates_MRU() {
+    auto &ws = ew;
+    const auto oldY = ws->sharedY(0);
+    ws->sharedE(0);
+    const size_t cached = ws->MRUSize();
+    auto &eventList = ws->getSpectrum(0);
+    eventList.addToCachedHistogram(ws->getSpectrum(1), false);
+    eventList += ws->getSpectrum(1);
+    eventList.addToCachedHistogram(eventList, false);
+    eventList += eventList;
+    eventList.addToCachedHistogram(ws->getSpectrum(2), true);
+    eventList -= ws->getSpectrum(2);
+    // The cached histogram was updated in place rather than dropped
+    TS_ASSERT_EQUALS(ws->MRUSize(), cached);
+    ws->resetMRUCounters();
+    const auto y = ws->y(0);
+    const auto e = ws->e(0);
+    TS_ASSERT_EQUALS(ws->MRUHits(), 2);
+    TS_ASSERT_EQUALS(ws->MRUMisses(), 0);
+    TS_ASSERT_DIFFERS(oldY->rawData(), y.rawData());
+
+    ws->clearMRU();
+    const auto &expectedY = ws->y(0);
+    const auto &expectedE = ws->e(0);
+    TS_ASSERT_EQUALS(ws->MRUMisses(), 1);
+    for (size_t i = 0; i < y.size(); ++i) {
+      TS_ASSERT_DELTA(y[i], expectedY[i], 1e-10);
+      TS_ASSERT_DELTA(e[i], expectedE[i], 1e-10);
+    }
+  }
+
   void test_swapping_spectrum_numbers_does_not_break_MRU() {
     int numEvents = 2;
     int numHistograms = 2;
@@ -203,34 +203,39 @@ public:
   }
 
   //-------------------------------------------------------------------------------------
-  /** MDBox->addEvent() tracks when a box is too big.
-   * MDEventWorkspace->splitTrackedBoxes() splits them
+  /** MDEventWorkspace->addTrackedEvent() returns the box the event went to.
+   * MDEventWorkspace->splitTrackedBoxes() splits those that are too big
    * */
   void test_splitTrackedBoxes() {
-    return; // FIXME with ticket 5102, if/when it is complete
-    //    MDEventWorkspace1Lean::sptr ew = MDEventsTestHelper::makeMDEW<1>(2,
-    //    0.0, 1.0, 0);
-    //    BoxController_sptr bc = ew->getBoxController();
-    //    bc->setSplitInto(2);
-    //    bc->setSplitThreshold(100);
-    //    ew->splitBox();
-    //
-    //    typedef MDGridBox<MDLeanEvent<1>,1> gbox_t;
-    //    typedef MDBox<MDLeanEvent<1>,1> box_t;
-    //    typedef MDBoxBase<MDLeanEvent<1>,1> ibox_t;
-    //
-    //    // Make 99 events
-    //    coord_t centers[1] = {0};
-    //    for (size_t i=0; i<99; i++)
-    //    {
-    //      centers[0] = coord_t(i)*0.001;
-    //      ew->addEvent(MDEvent<1>(1.0, 1.0, centers) );
-    //    }
-    //    TS_ASSERT_EQUALS( bc->getBoxesToSplit().size(), 0);
-    //
-    //    // The 100th event triggers the adding to the list
-    //    ew->addEvent(MDEvent<1>(1.0, 1.0, centers) );
-    //    TS_ASSERT_EQUALS( bc->getBoxesToSplit().size(), 1);
+    // 10x10 boxes with one event each, split threshold of 100
+    auto ew = MDEventsTestHelper::makeMDEW<2>(10, 0.0, 10.0, 1);
+    BoxController_sptr bc = ew->getBoxController();
+    const size_t numBoxes = bc->getTotalNumMDBoxes();
+
+    std::vector<API::IMDNode *> tracked;
+    for (size_t i = 0; i < 150; i++) {
+      const coord_t centers[2] = {2.05f + 0.006f * static_cast<coord_t>(i),
+                                  2.5f};
+      tracked.emplace_back(
+          ew->addTrackedEvent(MDLeanEvent<2>(1.0, 1.0, centers)));
+    }
+    const coord_t small[2] = {7.5f, 7.5f};
+    for (size_t i = 0; i < 10; i++)
+      tracked.emplace_back(
+          ew->addTrackedEvent(MDLeanEvent<2>(1.0, 1.0, small)));
+    // The events went to the boxes holding them
+    const coord_t big[2] = {2.5f, 2.5f};
+    TS_ASSERT_EQUALS(tracked.front(), ew->getBox()->getBoxAtCoord(big));
+    TS_ASSERT_EQUALS(tracked.back(), ew->getBox()->getBoxAtCoord(small));
+
+    ew->splitTrackedBoxes(tracked, nullptr);
+    TS_ASSERT_EQUALS(tracked.size(), 2);
+    // Only the box with 151 events was split, into 10x10 boxes
+    TS_ASSERT_EQUALS(bc->getTotalNumMDBoxes(), numBoxes + 99);
+    TS_ASSERT_EQUALS(ew->getBox()->getBoxAtCoord(big)->getDepth(), 2);
+    TS_ASSERT_EQUALS(ew->getBox()->getBoxAtCoord(small)->getDepth(), 1);
+    ew->refreshCache();
+    TS_ASSERT_EQUALS(ew->getNPoints(), 100 + 160);
   }
 
   //-------------------------------------------------------------------------------------
@@ -0,0 +1,110 @@
+// Mantid Repository : https://github.com/mantidproject/mantid
+//
+// Copyright &copy; 2020 ISIS Rutherford Appleton Laboratory UKRI,
+//   NScD Oak Ridge National Laboratory, European Spallation Source,
+//   Institut Laue - Langevin & CSNS, Institute of High Energy Physics, CAS
+// SPDX - License - Identifier: GPL - 3.0 +
+#pragma once
+
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <mutex>
+#include <stdexcept>
+
+namespace Mantid {
+namespace Kernel {
+
+/** BoundedQueue : A first-in first-out queue, shared between threads, that
+  holds at most a fixed number of items. Producers block while it is full and
+  consumers block while it is empty, so it connects the stages of a pipeline
+  while limiting how far a fast stage can run ahead of a slow one.
+
+  Once closed, no more items are accepted and consumers are given the items
+  remaining before being told that the queue is finished.
+*/
+template <class T> class BoundedQueue {
+public:
+  /** Constructor
+   * @param capacity :: the maximum number of items held
+   * @throw std::invalid_argument if the capacity is zero
+   */
+  explicit BoundedQueue(const std::size_t capacity) : m_capacity(capacity) {
+    if (capacity == 0)
+      throw std::invalid_argument("BoundedQueue: capacity must be positive");
+  }
+
+  /** Add an item, waiting until there is space for it
+   * @param item :: the item to add
+   * @return false if the queue was closed, in which case the item is dropped
+   */
+  bool push(T item) {
+    std::unique_lock<std::mutex> lock(m_mutex);
+    m_notFull.wait(lock,
+                   [this] { return m_closed || m_items.size() < m_capacity; });
+    if (m_closed)
+      return false;
+    m_items.emplace_back(std::move(item));
+    lock.unlock();
+    m_notEmpty.notify_one();
+    return true;
+  }
+
+  /** Remove the oldest item, waiting until there is one
+   * @param item :: set to the item removed
+   * @return false if the queue is closed and empty
+   */
+  bool pop(T &item) {
+    std::unique_lock<std::mutex> lock(m_mutex);
+    m_notEmpty.wait(lock, [this] { return m_closed || !m_items.empty(); });
+    if (m_items.empty())
+      return false;
+    item = std::move(m_items.front());
+    m_items.pop_front();
+    lock.unlock();
+    m_notFull.notify_one();
+    return true;
+  }
+
+  /// Stop accepting items and wake every waiting thread
+  void close() {
+    {
+      std::lock_guard<std::mutex> lock(m_mutex);
+      m_closed = true;
+    }
+    m_notFull.notify_all();
+    m_notEmpty.notify_all();
+  }
+
+  /// @return true if the queue has been closed
+  bool closed() const {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_closed;
+  }
+
+  /// @return the number of items waiting in the queue
+  std::size_t size() const {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_items.size();
+  }
+
+  /// @return the maximum number of items held
+  std::size_t capacity() const { return m_capacity; }
+
+private:
+  /// Maximum number of items held
+  const std::size_t m_capacity;
+  /// Items waiting to be popped, oldest first
+  std::deque<T> m_items;
+  /// True once no more items will be accepted
+  bool m_closed{false};
+  /// Guards the items and the closed flag
+  mutable std::mutex m_mutex;
+  /// Signalled when an item is removed
+  std::condition_variable m_notFull;
+  /// Signalled when an item is added
+  std::condition_variable m_notEmpty;
+};
+
+} // namespace Kernel
+} // namespace Mantid
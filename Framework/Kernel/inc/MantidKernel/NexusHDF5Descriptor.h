@@ -8,16 +8,40 @@
 
 #include "MantidKernel/DllConfig.h"
 
+#include <cstddef>
 #include <map>
+#include <memory>
 #include <set>
 #include <string>
 
 namespace Mantid {
 namespace Kernel {
 
+/** NexusHDF5Descriptor : Describes the entries of a NeXus HDF5 file, which are
+  found by walking the whole file.
+
+  As the walk can take seconds for files with many objects, the entries of the
+  files described most recently are kept in memory, so that a file can be
+  described again, e.g. by each loader asked for its confidence and then by
+  the loader chosen, without walking it again. If the
+  nexuscache.directory key is set, the entries are also kept in files in
+  that directory so that they are reused between sessions. Files are
+  identified by their path, size, modification time and inode, so the
+  entries of a file that has changed are never reused.
+*/
 class MANTID_KERNEL_DLL NexusHDF5Descriptor {
 
 public:
+  /// Counts of where the entries of the files described were found
+  struct CacheStatistics {
+    /// Entries found in memory
+    std::size_t memoryHits{0};
+    /// Entries found in the on-disk cache
+    std::size_t diskHits{0};
+    /// Entries found by walking the file
+    std::size_t misses{0};
+  };
+
   /**
    * Unique constructor
    * @param filename input HDF5 Nexus file name
@@ -34,6 +58,13 @@ public:
   /// Returns true if the file is considered to store data in a hierarchy
   static bool isReadable(const std::string &filename);
 
+  /// Returns the counts of where the entries of the files described were found
+  static CacheStatistics getCacheStatistics();
+
+  /// Forgets the entries held in memory and resets the statistics. The
+  /// on-disk cache is kept.
+  static void clearCache();
+
   /**
    * Returns a copy of the current file name
    * @return
@@ -72,7 +103,14 @@ public:
 
 private:
   /**
-   * Sets m_allEntries, called in HDF5 constructor.
+   * Sets m_allEntries, called in HDF5 constructor, from the cache or else by
+   * walking the file. m_filename must be set
+   */
+  std::shared_ptr<const std::map<std::string, std::set<std::string>>>
+  getCachedEntries();
+
+  /**
+   * Finds all the entries by walking the file.
    * m_filename must be set
    */
   std::map<std::string, std::set<std::string>> initAllEntries();
@@ -88,7 +126,8 @@ private:
    *          (e.g. /entry/log)
    * </pre>
    */
-  const std::map<std::string, std::set<std::string>> m_allEntries;
+  const std::shared_ptr<const std::map<std::string, std::set<std::string>>>
+      m_allEntries;
 };
 
 } // namespace Kernel
@@ -173,6 +173,22 @@ public:
    */
   virtual double singleFromTOF(const double tof) const = 0;
 
+  /** Convert an array of values to TOF in place. Units with a closed form
+   * conversion override this with a loop the compiler can vectorize; the
+   * default calls singleToTOF() for each value.
+   * @param values :: the values to convert
+   * @param count :: the number of values
+   */
+  virtual void multipleToTOF(double *values, const std::size_t count) const;
+
+  /** Convert an array of tof values to this unit in place. Units with a
+   * closed form conversion override this with a loop the compiler can
+   * vectorize; the default calls singleFromTOF() for each value.
+   * @param values :: the values to convert
+   * @param count :: the number of values
+   */
+  virtual void multipleFromTOF(double *values, const std::size_t count) const;
+
   /// @return true if the unit was initialized and so can use singleToTOF()
   bool isInitialized() const { return initialized; }
 
@@ -291,6 +307,8 @@ public:
   void init() override;
   double singleToTOF(const double x) const override;
   double singleFromTOF(const double tof) const override;
+  void multipleToTOF(double *values, const std::size_t count) const override;
+  void multipleFromTOF(double *values, const std::size_t count) const override;
   Unit *clone() const override;
   ///@return -DBL_MAX as ToF convertible to TOF for in any time range
   double conversionTOFMin() const override;
@@ -308,6 +326,8 @@ public:
 
   double singleToTOF(const double x) const override;
   double singleFromTOF(const double tof) const override;
+  void multipleToTOF(double *values, const std::size_t count) const override;
+  void multipleFromTOF(double *values, const std::size_t count) const override;
   void init() override;
   Unit *clone() const override;
 
@@ -335,6 +355,8 @@ public:
 
   double singleToTOF(const double x) const override;
   double singleFromTOF(const double tof) const override;
+  void multipleToTOF(double *values, const std::size_t count) const override;
+  void multipleFromTOF(double *values, const std::size_t count) const override;
   void init() override;
   Unit *clone() const override;
 
@@ -382,6 +404,8 @@ public:
 
   double singleToTOF(const double x) const override;
   double singleFromTOF(const double tof) const override;
+  void multipleToTOF(double *values, const std::size_t count) const override;
+  void multipleFromTOF(double *values, const std::size_t count) const override;
   void init() override;
   Unit *clone() const override;
   double conversionTOFMin() const override;
@@ -536,6 +560,8 @@ public:
 
   double singleToTOF(const double ki) const override;
   double singleFromTOF(const double tof) const override;
+  void multipleToTOF(double *values, const std::size_t count) const override;
+  void multipleFromTOF(double *values, const std::size_t count) const override;
   void init() override;
   Unit *clone() const override;
   double conversionTOFMin() const override;
@@ -562,6 +588,8 @@ public:
 
   double singleToTOF(const double x) const override;
   double singleFromTOF(const double tof) const override;
+  void multipleToTOF(double *values, const std::size_t count) const override;
+  void multipleFromTOF(double *values, const std::size_t count) const override;
   void init() override;
   Unit *clone() const override;
   double conversionTOFMin() const override;
@@ -581,6 +609,8 @@ public:
 
   double singleToTOF(const double x) const override;
   double singleFromTOF(const double tof) const override;
+  void multipleToTOF(double *values, const std::size_t count) const override;
+  void multipleFromTOF(double *values, const std::size_t count) const override;
   void init() override;
   Unit *clone() const override;
   double conversionTOFMin() const override;
@@ -9,12 +9,26 @@
 
 #include <boost/multi_index/detail/index_matcher.hpp>
 
+#include "MantidKernel/ConfigService.h"
+#include "MantidKernel/Logger.h"
 #include "MantidKernel/NexusDescriptor.h"
 
 #include <hdf5.h>
 
-#include <cstdlib>   // malloc, calloc
-#include <cstring>   // strcpy
+#include <Poco/File.h>
+#include <Poco/Path.h>
+
+#include <sys/stat.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <cstdlib> // malloc, calloc
+#include <cstring> // strcpy
+#include <fstream>
+#include <functional>
+#include <list>
+#include <mutex>
+#include <sstream>
 #include <stdexcept> // std::invalid_argument
 
 using boost::multi_index::detail::index_matcher::entry;
@@ -180,6 +194,165 @@ void getGroup(hid_t groupID,
   }
 }
 
+/// static logger
+Logger g_log("NexusHDF5Descriptor");
+
+using Entries = std::map<std::string, std::set<std::string>>;
+
+/// Identifies the contents of a file without reading it
+struct FileIdentity {
+  std::string path;
+  int64_t size{0};
+  int64_t mtime{0};
+  uint64_t inode{0};
+
+  bool operator==(const FileIdentity &other) const {
+    return path == other.path && size == other.size && mtime == other.mtime &&
+           inode == other.inode;
+  }
+};
+
+/**
+ * Identify a file from its absolute path, size, modification time in
+ * nanoseconds and inode
+ * @param filename input file name
+ * @return the identity, with an empty path if the file cannot be found
+ */
+FileIdentity identifyFile(const std::string &filename) {
+  FileIdentity identity;
+#ifdef _WIN32
+  struct _stat64 info;
+  if (_stat64(filename.c_str(), &info) != 0)
+    return identity;
+  identity.mtime = static_cast<int64_t>(info.st_mtime) * 1000000000;
+#else
+  struct stat info;
+  if (stat(filename.c_str(), &info) != 0)
+    return identity;
+#ifdef __APPLE__
+  identity.mtime = static_cast<int64_t>(info.st_mtimespec.tv_sec) * 1000000000 +
+                   info.st_mtimespec.tv_nsec;
+#else
+  identity.mtime = static_cast<int64_t>(info.st_mtim.tv_sec) * 1000000000 +
+                   info.st_mtim.tv_nsec;
+#endif
+  identity.inode = static_cast<uint64_t>(info.st_ino);
+#endif
+  identity.size = static_cast<int64_t>(info.st_size);
+  identity.path = Poco::Path(filename).makeAbsolute().toString();
+  return identity;
+}
+
+/// First line of the files of the on-disk cache, giving the format version
+const std::string CACHE_FILE_HEADER = "MantidNexusHDF5DescriptorCache 1";
+
+/**
+ * @param identity of the file described
+ * @return the file of the on-disk cache holding the entries of a file, or an
+ * empty string if there is no on-disk cache
+ */
+std::string cacheFilename(const FileIdentity &identity) {
+  const std::string directory =
+      ConfigService::Instance().getString("nexuscache.directory");
+  if (directory.empty())
+    return directory;
+  std::ostringstream name;
+  name << std::hex << std::hash<std::string>{}(identity.path) << ".entries";
+  return Poco::Path(directory, name.str()).toString();
+}
+
+/**
+ * Read the entries of a file from the on-disk cache
+ * @param identity of the file described
+ * @return the entries, or null if they are not in the cache or the file has
+ * changed since they were written
+ */
+std::shared_ptr<const Entries> readCacheFile(const FileIdentity &identity) {
+  const std::string filename = cacheFilename(identity);
+  if (filename.empty())
+    return nullptr;
+  std::ifstream file(filename);
+  std::string line;
+  if (!std::getline(file, line) || line != CACHE_FILE_HEADER)
+    return nullptr;
+  FileIdentity cached;
+  std::size_t numClasses = 0;
+  if (!std::getline(file, cached.path) ||
+      !(file >> cached.size >> cached.mtime >> cached.inode >> numClasses) ||
+      !(cached == identity))
+    return nullptr;
+
+  auto entries = std::make_shared<Entries>();
+  for (std::size_t i = 0; i < numClasses; ++i) {
+    std::string groupClass;
+    std::size_t numEntries = 0;
+    file >> std::ws;
+    if (!std::getline(file, groupClass) || !(file >> numEntries))
+      return nullptr;
+    file >> std::ws;
+    auto &classEntries = (*entries)[groupClass];
+    for (std::size_t j = 0; j < numEntries; ++j) {
+      if (!std::getline(file, line))
+        return nullptr;
+      classEntries.insert(classEntries.end(), line);
+    }
+  }
+  return entries;
+}
+
+/**
+ * Write the entries of a file to the on-disk cache, if there is one. Failures
+ * are only logged, as the cache is just a shortcut.
+ * @param identity of the file described
+ * @param entries of the file
+ */
+void writeCacheFile(const FileIdentity &identity, const Entries &entries) {
+  const std::string filename = cacheFilename(identity);
+  if (filename.empty())
+    return;
+  try {
+    Poco::File(Poco::Path(filename).parent()).createDirectories();
+    // Write to a temporary file first so that a reader never sees part of it
+    const std::string tempFilename = filename + ".tmp";
+    {
+      std::ofstream file(tempFilename);
+      file << CACHE_FILE_HEADER << '\n'
+           << identity.path << '\n'
+           << identity.size << ' ' << identity.mtime << ' ' << identity.inode
+           << '\n'
+           << entries.size() << '\n';
+      for (const auto &classEntries : entries) {
+        file << classEntries.first << '\n'
+             << classEntries.second.size() << '\n';
+        for (const auto &entry : classEntries.second)
+          file << entry << '\n';
+      }
+      if (!file)
+        throw std::runtime_error("error writing " + tempFilename);
+    }
+    Poco::File(tempFilename).renameTo(filename);
+  } catch (std::exception &e) {
+    g_log.warning() << "Could not write the entries of " << identity.path
+                    << " to the NeXus cache: " << e.what() << '\n';
+  }
+}
+
+/// The entries of the files described most recently, and the statistics
+struct EntriesCache {
+  /// Number of files whose entries are kept in memory
+  static constexpr std::size_t MAX_FILES = 8;
+
+  std::mutex mutex;
+  /// Most recently used first
+  std::list<std::pair<FileIdentity, std::shared_ptr<const Entries>>> files;
+  NexusHDF5Descriptor::CacheStatistics statistics;
+};
+
+EntriesCache &entriesCache() {
+  static EntriesCache cache;
+  return cache;
+}
+
 } // namespace
 
 bool NexusHDF5Descriptor::isReadable(const std::string &filename) {
@@ -188,8 +361,22 @@ bool NexusHDF5Descriptor::isReadable(const std::string &filename) {
                                      NexusDescriptor::Version::Version5);
 }
 
+NexusHDF5Descriptor::CacheStatistics
+NexusHDF5Descriptor::getCacheStatistics() {
+  auto &cache = entriesCache();
+  std::lock_guard<std::mutex> lock(cache.mutex);
+  return cache.statistics;
+}
+
+void NexusHDF5Descriptor::clearCache() {
+  auto &cache = entriesCache();
+  std::lock_guard<std::mutex> lock(cache.mutex);
+  cache.files.clear();
+  cache.statistics = CacheStatistics();
+}
+
 NexusHDF5Descriptor::NexusHDF5Descriptor(const std::string &filename)
-    : m_filename(filename), m_allEntries(initAllEntries()) {}
+    : m_filename(filename), m_allEntries(getCachedEntries()) {}
 
 // PUBLIC
 std::string NexusHDF5Descriptor::getFilename() const noexcept {
@@ -198,10 +385,52 @@ std::string NexusHDF5Descriptor::getFilename() const noexcept {
 
 const std::map<std::string, std::set<std::string>> &
 NexusHDF5Descriptor::getAllEntries() const noexcept {
-  return m_allEntries;
+  return *m_allEntries;
 }
 
 // PRIVATE
+std::shared_ptr<const std::map<std::string, std::set<std::string>>>
+NexusHDF5Descriptor::getCachedEntries() {
+  const FileIdentity identity = identifyFile(m_filename);
+  auto &cache = entriesCache();
+  if (!identity.path.empty()) {
+    std::lock_guard<std::mutex> lock(cache.mutex);
+    const auto it = std::find_if(
+        cache.files.begin(), cache.files.end(),
+        [&identity](const auto &file) { return file.first == identity; });
+    if (it != cache.files.end()) {
+      cache.files.splice(cache.files.begin(), cache.files, it);
+      ++cache.statistics.memoryHits;
+      return it->second;
+    }
+  }
+
+  // The file is walked outside of the lock, so files can be described at the
+  // same time
+  auto entries = identity.path.empty() ? nullptr : readCacheFile(identity);
+  const bool fromDisk = entries != nullptr;
+  if (!fromDisk) {
+    entries = std::make_shared<const Entries>(initAllEntries());
+    if (!identity.path.empty())
+      writeCacheFile(identity, *entries);
+  }
+  g_log.debug() << "Entries of " << m_filename << " found "
+                << (fromDisk ? "in the NeXus cache" : "by walking the file")
+                << '\n';
+
+  std::lock_guard<std::mutex> lock(cache.mutex);
+  if (fromDisk)
+    ++cache.statistics.diskHits;
+  else
+    ++cache.statistics.misses;
+  if (!identity.path.empty()) {
+    cache.files.emplace_front(identity, entries);
+    if (cache.files.size() > EntriesCache::MAX_FILES)
+      cache.files.pop_back();
+  }
+  return entries;
+}
+
 std::map<std::string, std::set<std::string>>
 NexusHDF5Descriptor::initAllEntries() {
 
@@ -232,8 +461,8 @@ bool NexusHDF5Descriptor::isEntry(const std::string &entryName,
                                   const std::string &groupClass) const
     noexcept {
 
-  auto itClass = m_allEntries.find(groupClass);
-  if (itClass == m_allEntries.end()) {
+  auto itClass = m_allEntries->find(groupClass);
+  if (itClass == m_allEntries->end()) {
     return false;
   }
 
@@ -246,7 +475,7 @@ bool NexusHDF5Descriptor::isEntry(const std::string &entryName,
 
 bool NexusHDF5Descriptor::isEntry(const std::string &entryName) const noexcept {
 
-  for (auto itClass = m_allEntries.rbegin(); itClass != m_allEntries.rend();
+  for (auto itClass = m_allEntries->rbegin(); itClass != m_allEntries->rend();
        ++itClass) {
     if (itClass->second.count(entryName) == 1) {
       return true;
@@ -138,9 +138,7 @@ void Unit::toTOF(std::vector<double> &xdata, std::vector<double> &ydata,
                  const double &_delta) {
   UNUSED_ARG(ydata);
   this->initialize(_l1, _l2, _twoTheta, _emode, _efixed, _delta);
-  size_t numX = xdata.size();
-  for (size_t i = 0; i < numX; i++)
-    xdata[i] = this->singleToTOF(xdata[i]);
+  this->multipleToTOF(xdata.data(), xdata.size());
 }
 
 /** Convert a single value to TOF
@@ -169,9 +167,7 @@ void Unit::fromTOF(std::vector<double> &xdata, std::vector<double> &ydata,
                    const double &_efixed, const double &_delta) {
   UNUSED_ARG(ydata);
   this->initialize(_l1, _l2, _twoTheta, _emode, _efixed, _delta);
-  size_t numX = xdata.size();
-  for (size_t i = 0; i < numX; i++)
-    xdata[i] = this->singleFromTOF(xdata[i]);
+  this->multipleFromTOF(xdata.data(), xdata.size());
 }
 
 /** Convert a single value from TOF
@@ -191,6 +187,16 @@ double Unit::convertSingleFromTOF(const double xvalue, const double &l1,
   return this->singleFromTOF(xvalue);
 }
 
+void Unit::multipleToTOF(double *values, const std::size_t count) const {
+  for (size_t i = 0; i < count; ++i)
+    values[i] = this->singleToTOF(values[i]);
+}
+
+void Unit::multipleFromTOF(double *values, const std::size_t count) const {
+  for (size_t i = 0; i < count; ++i)
+    values[i] = this->singleFromTOF(values[i]);
+}
+
 std::pair<double, double> Unit::conversionRange() const {
   double u1 = this->singleFromTOF(this->conversionTOFMin());
   double u2 = this->singleFromTOF(this->conversionTOFMax());
@@ -287,6 +293,18 @@ double TOF::singleFromTOF(const double tof) const {
   return tof;
 }
 
+void TOF::multipleToTOF(double *values, const std::size_t count) const {
+  // Nothing to do
+  UNUSED_ARG(values);
+  UNUSED_ARG(count);
+}
+
+void TOF::multipleFromTOF(double *values, const std::size_t count) const {
+  // Nothing to do
+  UNUSED_ARG(values);
+  UNUSED_ARG(count);
+}
+
 Unit *TOF::clone() const { return new TOF(*this); }
 double TOF::conversionTOFMin() const { return -DBL_MAX; }
 ///@return DBL_MAX as ToF convetanble to TOF for in any time range
@@ -388,6 +406,23 @@ double Wavelength::singleFromTOF(const double tof) const {
   x *= factorFrom;
   return x;
 }
+void Wavelength::multipleToTOF(double *values, const std::size_t count) const {
+  for (size_t i = 0; i < count; ++i)
+    values[i] *= factorTo;
+  if (emode == 1 || emode == 2) {
+    for (size_t i = 0; i < count; ++i)
+      values[i] += sfpTo;
+  }
+}
+void Wavelength::multipleFromTOF(double *values,
+                                 const std::size_t count) const {
+  if (do_sfpFrom) {
+    for (size_t i = 0; i < count; ++i)
+      values[i] -= sfpFrom;
+  }
+  for (size_t i = 0; i < count; ++i)
+    values[i] *= factorFrom;
+}
 ///@return  Minimal time of flight, which can be reversively converted into
 /// wavelength
 double Wavelength::conversionTOFMin() const {
@@ -464,6 +499,22 @@ double Energy::singleFromTOF(const double tof) const {
   return factorFrom / (temp * temp);
 }
 
+void Energy::multipleToTOF(double *values, const std::size_t count) const {
+  for (size_t i = 0; i < count; ++i) {
+    // Protect against divide by zero
+    const double temp = values[i] == 0.0 ? DBL_MIN : values[i];
+    values[i] = factorTo / sqrt(temp);
+  }
+}
+
+void Energy::multipleFromTOF(double *values, const std::size_t count) const {
+  for (size_t i = 0; i < count; ++i) {
+    // Protect against divide by zero
+    const double temp = values[i] == 0.0 ? DBL_MIN : values[i];
+    values[i] = factorFrom / (temp * temp);
+  }
+}
+
 Unit *Energy::clone() const { return new Energy(*this); }
 
 // ============================================================================================
@@ -570,6 +621,14 @@ double dSpacing::singleToTOF(const double x) const { return x * factorTo; }
 double dSpacing::singleFromTOF(const double tof) const {
   return tof / factorFrom;
 }
+void dSpacing::multipleToTOF(double *values, const std::size_t count) const {
+  for (size_t i = 0; i < count; ++i)
+    values[i] *= factorTo;
+}
+void dSpacing::multipleFromTOF(double *values, const std::size_t count) const {
+  for (size_t i = 0; i < count; ++i)
+    values[i] /= factorFrom;
+}
 double dSpacing::conversionTOFMin() const { return 0; }
 double dSpacing::conversionTOFMax() const { return DBL_MAX / factorTo; }
 
@@ -1050,6 +1109,26 @@ double Momentum::singleFromTOF(const double tof) const {
   return factorFrom / x;
 }
 
+void Momentum::multipleToTOF(double *values, const std::size_t count) const {
+  for (size_t i = 0; i < count; ++i)
+    values[i] = factorTo / values[i];
+  if (emode == 1 || emode == 2) {
+    for (size_t i = 0; i < count; ++i)
+      values[i] += sfpTo;
+  }
+}
+
+void Momentum::multipleFromTOF(double *values, const std::size_t count) const {
+  if (do_sfpFrom) {
+    for (size_t i = 0; i < count; ++i)
+      values[i] -= sfpFrom;
+  }
+  for (size_t i = 0; i < count; ++i) {
+    const double x = values[i] == 0 ? DBL_MIN : values[i];
+    values[i] = factorFrom / x;
+  }
+}
+
 Unit *Momentum::clone() const { return new Momentum(*this); }
 
 // ============================================================================================
@@ -1101,6 +1180,20 @@ double SpinEchoLength::singleFromTOF(const double tof) const {
   return x;
 }
 
+void SpinEchoLength::multipleToTOF(double *values,
+                                   const std::size_t count) const {
+  for (size_t i = 0; i < count; ++i)
+    values[i] = sqrt(values[i] / efixed);
+  Wavelength::multipleToTOF(values, count);
+}
+
+void SpinEchoLength::multipleFromTOF(double *values,
+                                     const std::size_t count) const {
+  Wavelength::multipleFromTOF(values, count);
+  for (size_t i = 0; i < count; ++i)
+    values[i] = efixed * values[i] * values[i];
+}
+
 Unit *SpinEchoLength::clone() const { return new SpinEchoLength(*this); }
 
 // ============================================================================================
@@ -1146,6 +1239,20 @@ double SpinEchoTime::singleFromTOF(const double tof) const {
   return x;
 }
 
+void SpinEchoTime::multipleToTOF(double *values,
+                                 const std::size_t count) const {
+  for (size_t i = 0; i < count; ++i)
+    values[i] = pow(values[i] / efixed, 1.0 / 3.0);
+  Wavelength::multipleToTOF(values, count);
+}
+
+void SpinEchoTime::multipleFromTOF(double *values,
+                                   const std::size_t count) const {
+  Wavelength::multipleFromTOF(values, count);
+  for (size_t i = 0; i < count; ++i)
+    values[i] = efixed * values[i] * values[i] * values[i];
+}
+
 Unit *SpinEchoTime::clone() const { return new SpinEchoTime(*this); }
 
 // ================================================================================
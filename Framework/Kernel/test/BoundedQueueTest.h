@@ -0,0 +1,92 @@
+// Mantid Repository : https://github.com/mantidproject/mantid
+//
+// Copyright &copy; 2020 ISIS Rutherford Appleton Laboratory UKRI,
+//   NScD Oak Ridge National Laboratory, European Spallation Source,
+//   Institut Laue - Langevin & CSNS, Institute of High Energy Physics, CAS
+// SPDX - License - Identifier: GPL - 3.0 +
+#pragma once
+
+#include "MantidKernel/BoundedQueue.h"
+
+#include <cxxtest/TestSuite.h>
+
+#include <atomic>
+#include <thread>
+#include <vector>
+
+using Mantid::Kernel::BoundedQueue;
+
+class BoundedQueueTest : public CxxTest::TestSuite {
+public:
+  // This pair of boilerplate methods prevent the suite being created statically
+  // This means the constructor isn't called when running other tests
+  static BoundedQueueTest *createSuite() { return new BoundedQueueTest(); }
+  static void destroySuite(BoundedQueueTest *suite) { delete suite; }
+
+  void test_zero_capacity_throws() {
+    TS_ASSERT_THROWS(BoundedQueue<int>{0}, const std::invalid_argument &);
+  }
+
+  void test_items_come_out_in_order() {
+    BoundedQueue<int> queue(3);
+    TS_ASSERT(queue.push(1));
+    TS_ASSERT(queue.push(2));
+    TS_ASSERT(queue.push(3));
+    TS_ASSERT_EQUALS(queue.size(), 3);
+    int item = 0;
+    for (int expected = 1; expected <= 3; ++expected) {
+      TS_ASSERT(queue.pop(item));
+      TS_ASSERT_EQUALS(item, expected);
+    }
+    TS_ASSERT_EQUALS(queue.size(), 0);
+  }
+
+  void test_close_drains_remaining_items_then_finishes() {
+    BoundedQueue<int> queue(2);
+    queue.push(7);
+    queue.close();
+    TS_ASSERT(queue.closed());
+    TS_ASSERT(!queue.push(8));
+    int item = 0;
+    TS_ASSERT(queue.pop(item));
+    TS_ASSERT_EQUALS(item, 7);
+    TS_ASSERT(!queue.pop(item));
+  }
+
+  void test_close_wakes_blocked_producer() {
+    BoundedQueue<int> queue(1);
+    queue.push(1);
+    std::atomic<bool> pushed{true};
+    std::thread producer([&] { pushed = queue.push(2); });
+    queue.close();
+    producer.join();
+    TS_ASSERT(!pushed);
+  }
+
+  void test_producers_and_consumers_pass_every_item_once() {
+    BoundedQueue<int> queue(4);
+    constexpr int numItems = 10000;
+    std::atomic<long long> sum{0};
+    std::atomic<int> count{0};
+    std::vector<std::thread> consumers;
+    for (int i = 0; i < 3; ++i)
+      consumers.emplace_back([&] {
+        int item;
+        while (queue.pop(item)) {
+          sum += item;
+          ++count;
+        }
+      });
+    std::thread producer([&] {
+      for (int i = 1; i <= numItems; ++i)
+        queue.push(i);
+      queue.close();
+    });
+    producer.join();
+    for (auto &consumer : consumers)
+      consumer.join();
+    TS_ASSERT_EQUALS(count, numItems);
+    TS_ASSERT_EQUALS(sum,
+                     static_cast<long long>(numItems) * (numItems + 1) / 2);
+  }
+};
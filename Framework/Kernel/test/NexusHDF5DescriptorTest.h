@@ -78,4 +78,47 @@ public:
 
     TS_ASSERT_EQUALS(nEntries, 2923);
   }
+
+  void test_entries_are_cached_in_memory() {
+    using Mantid::Kernel::NexusHDF5Descriptor;
+    const std::string filename = getFullPath("EQSANS_89157.nxs.h5");
+    NexusHDF5Descriptor::clearCache();
+
+    NexusHDF5Descriptor first(filename);
+    NexusHDF5Descriptor second(filename);
+
+    const auto statistics = NexusHDF5Descriptor::getCacheStatistics();
+    TS_ASSERT_EQUALS(statistics.misses, 1);
+    TS_ASSERT_EQUALS(statistics.memoryHits, 1);
+    TS_ASSERT_EQUALS(statistics.diskHits, 0);
+    TS_ASSERT_EQUALS(first.getAllEntries(), second.getAllEntries());
+    TS_ASSERT_EQUALS(second.getFilename(), filename);
+  }
+
+  void test_entries_are_cached_on_disk() {
+    using Mantid::Kernel::ConfigService;
+    using Mantid::Kernel::NexusHDF5Descriptor;
+    const std::string filename = getFullPath("EQSANS_89157.nxs.h5");
+    const Poco::Path cacheDirectory(Poco::Path::temp(),
+                                    "NexusHDF5DescriptorTestCache");
+    auto &config = ConfigService::Instance();
+    const std::string oldDirectory = config.getString("nexuscache.directory");
+    config.setString("nexuscache.directory", cacheDirectory.toString());
+    NexusHDF5Descriptor::clearCache();
+
+    NexusHDF5Descriptor written(filename);
+    // Only the on-disk cache is left
+    NexusHDF5Descriptor::clearCache();
+    NexusHDF5Descriptor read(filename);
+
+    const auto statistics = NexusHDF5Descriptor::getCacheStatistics();
+    TS_ASSERT_EQUALS(statistics.misses, 0);
+    TS_ASSERT_EQUALS(statistics.memoryHits, 0);
+    TS_ASSERT_EQUALS(statistics.diskHits, 1);
+    TS_ASSERT_EQUALS(written.getAllEntries(), read.getAllEntries());
+
+    config.setString("nexuscache.directory", oldDirectory);
+    NexusHDF5Descriptor::clearCache();
+    Poco::File(cacheDirectory).remove(true);
+  }
 };
@@ -11,6 +11,7 @@
 #include "MantidKernel/PhysicalConstants.h"
 #include "MantidKernel/Unit.h"
 #include "MantidKernel/UnitLabelTypes.h"
+#include <algorithm>
 #include <boost/lexical_cast.hpp>
 #include <cfloat>
 #include <limits>
@@ -1516,7 +1517,43 @@ public:
     TS_ASSERT(check_vector_conversion(vec, 1.0));
   }
 
+  //----------------------------------------------------------------------
+  // Conversions of many values at once
+  //----------------------------------------------------------------------
+
+  void test_multipleToTOF_and_multipleFromTOF_match_single_conversions() {
+    for (int emode = 0; emode < 3; ++emode) {
+      checkMultipleConversions(tof, emode);
+      checkMultipleConversions(lambda, emode);
+      checkMultipleConversions(energy, emode);
+      checkMultipleConversions(d, emode);
+      checkMultipleConversions(k_i, emode);
+      // Uses the default, value by value, conversion
+      checkMultipleConversions(q, emode);
+    }
+    checkMultipleConversions(delta, 0);
+    checkMultipleConversions(tau, 0);
+  }
+
 private:
+  void checkMultipleConversions(Unit &unit, const int emode) {
+    unit.initialize(10.0, 1.5, 1.2, emode, 25.0, 0.0);
+    // Includes zero and values either side of the direct geometry offsets
+    std::vector<double> values{0.0, 0.5, 1.0, 250.0, 1000.5, 1e4, 2e4};
+    auto expected = values;
+    std::transform(expected.begin(), expected.end(), expected.begin(),
+                   [&unit](const double x) { return unit.singleToTOF(x); });
+    auto converted = values;
+    unit.multipleToTOF(converted.data(), converted.size());
+    TSM_ASSERT_EQUALS(unit.unitID() + " to TOF", converted, expected);
+
+    std::transform(values.begin(), values.end(), expected.begin(),
+                   [&unit](const double x) { return unit.singleFromTOF(x); });
+    converted = values;
+    unit.multipleFromTOF(converted.data(), converted.size());
+    TSM_ASSERT_EQUALS(unit.unitID() + " from TOF", converted, expected);
+  }
+
   Units::Label label;
   Units::TOF tof;
   Units::Wavelength lambda;
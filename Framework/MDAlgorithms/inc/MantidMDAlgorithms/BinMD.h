@@ -63,14 +63,41 @@ private:
   /// Run the algorithm
   void exec() override;
 
+  /// The signal, error squared and event count arrays a thread bins into
+  struct BinTarget {
+    signal_t *signals;
+    signal_t *errors;
+    signal_t *numEvents;
+  };
+  /// Where a box lands in the output, judged from its extents
+  enum class BoxPlacement { Outside, SingleBin, Spread };
+
   /// Helper method
   template <typename MDE, size_t nd>
   void binByIterating(typename DataObjects::MDEventWorkspace<MDE, nd>::sptr ws);
 
+  template <typename MDE, size_t nd>
+  void
+  binWithThreadArrays(typename DataObjects::MDEventWorkspace<MDE, nd>::sptr ws,
+                      const size_t numThreads);
+
+  template <typename MDE, size_t nd>
+  void binInChunks(typename DataObjects::MDEventWorkspace<MDE, nd>::sptr ws,
+                   const bool doParallel);
+
   /// Method to bin a single MDBox
   template <typename MDE, size_t nd>
   void binMDBox(DataObjects::MDBox<MDE, nd> *box, const size_t *const chunkMin,
-                const size_t *const chunkMax);
+                const size_t *const chunkMax, const BinTarget &target);
+
+  template <typename MDE, size_t nd>
+  void transformEvents(const MDE *events, const size_t numEvents,
+                       coord_t *outCoords) const;
+
+  void cacheTransform();
+  BoxPlacement placeBox(API::IMDNode &box, const size_t *const chunkMin,
+                        const size_t *const chunkMax,
+                        size_t &linearIndex) const;
 
   /// The output MDHistoWorkspace
   Mantid::DataObjects::MDHistoWorkspace_sptr outWS;
@@ -85,6 +112,19 @@ private:
   signal_t *errors;
   signal_t *numEvents;
   bool m_accumulate{false};
+
+  /// True if the transform only picks, shifts and scales input dimensions
+  bool m_alignedTransform{false};
+  /// For an aligned transform, the input dimension of each output dimension
+  std::vector<size_t> m_dimensionToBinFrom;
+  /// For an aligned transform, the origin of each output dimension
+  std::vector<coord_t> m_origin;
+  /// For an aligned transform, the scaling of each output dimension
+  std::vector<coord_t> m_scaling;
+  /// For a general transform, the rows of its affine matrix
+  std::vector<coord_t> m_affineRows;
+  /// The rows of the affine matrix in double precision, to bound boxes with
+  std::vector<double> m_boundsRows;
 };
 
 } // namespace MDAlgorithms
@@ -7,6 +7,7 @@
 #pragma once
 
 #include "MantidAPI/Algorithm.h"
+#include "MantidAPI/ExperimentInfo.h"
 #include "MantidGeometry/Crystal/SymmetryOperationFactory.h"
 #include "MantidMDAlgorithms/DllConfig.h"
 #include "MantidMDAlgorithms/SlicingAlgorithm.h"
@@ -46,12 +47,13 @@ private:
   getValuesFromOtherDimensions(bool &skipNormalization,
                                uint16_t expInfoIndex = 0) const;
   void cacheDimensionXValues();
+  void
+  cacheDetectorTrajectories(const API::ExperimentInfo_const_sptr &exptInfo);
   void calculateNormalization(const std::vector<coord_t> &otherValues,
                               const Geometry::SymmetryOperation &so,
                               uint16_t expInfoIndex, size_t soIndex);
   void calculateIntersections(std::vector<std::array<double, 4>> &intersections,
-                              const double theta, const double phi,
-                              const Kernel::DblMatrix &transform,
+                              const Kernel::V3D &qin, const Kernel::V3D &qout,
                               double lowvalue, double highvalue);
   void calcIntegralsForIntersections(const std::vector<double> &xValues,
                                      const API::MatrixWorkspace &integrFlux,
@@ -75,6 +77,20 @@ private:
   Mantid::Kernel::Matrix<coord_t> m_transformation;
   /// cached X values along dimensions h,k,l. dE
   std::vector<double> m_hX, m_kX, m_lX, m_eX;
+  /** Goniometer independent part of the detector trajectories, shared by
+  every run and symmetry operation with the same instrument geometry */
+  struct DetectorTrajectories {
+    /// Components of the unit vector along each scattered beam, lab frame
+    std::vector<double> x, y, z;
+    /// Solid angle of each spectrum (1 without a solid angle workspace)
+    std::vector<double> solidAngle;
+    /// Workspace index of each spectrum in the flux workspace
+    std::vector<size_t> fluxIndex;
+    /// Non-zero for spectra that contribute to the normalization
+    std::vector<char> contributes;
+    /// The experiment info the trajectories were computed from
+    API::ExperimentInfo_const_sptr exptInfo;
+  } m_trajectories;
   /// index of h,k,l, dE dimensions in the output workspaces
   size_t m_hIdx, m_kIdx, m_lIdx, m_eIdx;
   /// number of experimentInfo objects
@@ -48,6 +48,9 @@ private:
 
   /// Output MDEventWorkspace
   Mantid::API::IMDEventWorkspace_sptr out;
+
+  /// The output is the first input, with the others appended to it in place
+  bool m_inPlace = false;
 };
 
 } // namespace MDAlgorithms
@@ -388,7 +388,9 @@ void AccumulateMD::exec() {
 
   // If we reach here then new data exists to append to the input workspace
   // Use CreateMD with the new data to make a temp workspace
-  // Merge the temp workspace with the input workspace using MergeMD
+  // Merge the temp workspace with the input workspace using MergeMD. When the
+  // output replaces the input, MergeMD appends the new events to its existing
+  // boxes in place, and updates its file if it is file backed.
   IMDEventWorkspace_sptr tmp_ws =
       createMDWorkspace(input_data, psi, gl, gs, efix, "", false);
   this->interruption_point();
@@ -404,6 +406,9 @@ void AccumulateMD::exec() {
 
   Algorithm_sptr merge_alg = createChildAlgorithm("MergeMD");
   merge_alg->setProperty("InputWorkspaces", ws_names_to_merge);
+  if (this->getPropertyValue("OutputWorkspace") ==
+      this->getPropertyValue("InputWorkspace"))
+    merge_alg->setPropertyValue("OutputWorkspace", input_ws->getName());
   merge_alg->executeAsChildAlg();
 
   API::IMDEventWorkspace_sptr out_ws =
@@ -18,17 +18,26 @@
 #include "MantidGeometry/MDGeometry/MDHistoDimension.h"
 #include "MantidKernel/CPUTimer.h"
 #include "MantidKernel/EnabledWhenProperty.h"
+#include "MantidKernel/Memory.h"
 #include "MantidKernel/Strings.h"
 #include "MantidKernel/System.h"
 #include "MantidKernel/Utils.h"
 #include <boost/algorithm/string.hpp>
 
+#include <algorithm>
+#include <cmath>
+
 namespace Mantid {
 namespace MDAlgorithms {
 
 // Register the algorithm into the AlgorithmFactory
 DECLARE_ALGORITHM(BinMD)
 
+namespace {
+/// Number of events transformed to the output coordinates at once
+constexpr size_t BATCH_SIZE = 256;
+} // namespace
+
 using namespace Mantid::Kernel;
 using namespace Mantid::API;
 using namespace Mantid::Geometry;
@@ -90,6 +99,115 @@ void BinMD::init() {
                   "A name for the output MDHistoWorkspace.");
 }
 
+//----------------------------------------------------------------------------------------------
+/** Cache the transform to the output bins in a form that can be applied to
+ * many events at once and to the extents of boxes.
+ */
+void BinMD::cacheTransform() {
+  const size_t inD = m_transform->getInD();
+  const auto matrix = m_transform->makeAffineMatrix();
+  m_boundsRows.resize(m_outD * (inD + 1));
+  m_affineRows.resize(m_outD * (inD + 1));
+  for (size_t row = 0; row < m_outD; ++row)
+    for (size_t col = 0; col <= inD; ++col) {
+      m_affineRows[row * (inD + 1) + col] = matrix[row][col];
+      m_boundsRows[row * (inD + 1) + col] = matrix[row][col];
+    }
+
+  const auto *aligned =
+      dynamic_cast<const CoordTransformAligned *>(m_transform.get());
+  m_alignedTransform = aligned != nullptr;
+  if (aligned) {
+    m_dimensionToBinFrom = aligned->getDimensionToBinFrom();
+    m_origin = aligned->getOrigin();
+    m_scaling = aligned->getScaling();
+  }
+}
+
+//----------------------------------------------------------------------------------------------
+/** Transform the centers of a batch of events to the output bin coordinates.
+ * Each output dimension is done for the whole batch in turn, with the same
+ * arithmetic as the transform's apply(), so the inner loops run over events.
+ *
+ * @param events :: the first event of the batch
+ * @param numEvents :: the number of events in the batch
+ * @param outCoords :: the coordinates of the events, by output dimension, for
+ *batches of BATCH_SIZE events
+ */
+template <typename MDE, size_t nd>
+void BinMD::transformEvents(const MDE *events, const size_t numEvents,
+                            coord_t *outCoords) const {
+  for (size_t d = 0; d < m_outD; ++d) {
+    coord_t *out = outCoords + d * BATCH_SIZE;
+    if (m_alignedTransform) {
+      const size_t from = m_dimensionToBinFrom[d];
+      const coord_t origin = m_origin[d];
+      const coord_t scaling = m_scaling[d];
+      for (size_t i = 0; i < numEvents; ++i)
+        out[i] = (events[i].getCenter(from) - origin) * scaling;
+    } else {
+      const coord_t *row = m_affineRows.data() + d * (nd + 1);
+      for (size_t i = 0; i < numEvents; ++i) {
+        const coord_t *center = events[i].getCenter();
+        coord_t outVal = 0.0;
+        for (size_t in = 0; in < nd; ++in)
+          outVal += row[in] * center[in];
+        out[i] = outVal + row[nd];
+      }
+    }
+  }
+}
+
+//----------------------------------------------------------------------------------------------
+/** Find where a box lands in the output from the range its extents map to in
+ * each output dimension, widened a little for the rounding of the events.
+ *
+ * @param box :: the box
+ * @param chunkMin :: the minimum index in each dimension to consider "valid"
+ *(inclusive)
+ * @param chunkMax :: the maximum index in each dimension to consider "valid"
+ *(exclusive)
+ * @param linearIndex :: set to the index of the bin for a box in a single bin
+ * @return whether the box is outside the range, within one bin or spread over
+ *several
+ */
+BinMD::BoxPlacement BinMD::placeBox(API::IMDNode &box,
+                                    const size_t *const chunkMin,
+                                    const size_t *const chunkMax,
+                                    size_t &linearIndex) const {
+  const size_t inD = box.getNumDims();
+  bool singleBin = true;
+  linearIndex = 0;
+  for (size_t d = 0; d < m_outD; ++d) {
+    const double *row = m_boundsRows.data() + d * (inD + 1);
+    double low = row[inD];
+    double high = row[inD];
+    double magnitude = std::abs(row[inD]);
+    for (size_t in = 0; in < inD; ++in) {
+      const double fromMin = row[in] * box.getExtents(in).getMin();
+      const double fromMax = row[in] * box.getExtents(in).getMax();
+      low += std::min(fromMin, fromMax);
+      high += std::max(fromMin, fromMax);
+      magnitude += std::max(std::abs(fromMin), std::abs(fromMax));
+    }
+    const double margin = 1e-6 * (magnitude + 1.0);
+    low -= margin;
+    high += margin;
+
+    if (high < double(chunkMin[d]) || low >= double(chunkMax[d]))
+      return BoxPlacement::Outside;
+    if (singleBin) {
+      const double bin = std::floor(low);
+      if (low >= double(chunkMin[d]) && std::floor(high) == bin &&
+          bin < double(chunkMax[d]))
+        linearIndex += indexMultiplier[d] * static_cast<size_t>(bin);
+      else
+        singleBin = false;
+    }
+  }
+  return singleBin ? BoxPlacement::SingleBin : BoxPlacement::Spread;
+}
+
 //----------------------------------------------------------------------------------------------
 /** Bin the contents of a MDBox
  *
@@ -98,40 +216,51 @@ void BinMD::init() {
  *(inclusive)
  * @param chunkMax :: the maximum index in each dimension to consider "valid"
  *(exclusive)
+ * @param target :: the arrays to add the signal, errors and events to
  */
 template <typename MDE, size_t nd>
 inline void BinMD::binMDBox(MDBox<MDE, nd> *box, const size_t *const chunkMin,
-                            const size_t *const chunkMax) {
-  // An array to hold the rotated/transformed coordinates
-  auto outCenter = std::vector<coord_t>(m_outD);
-
-  // Evaluate whether the entire box is in the same bin
-  if (box->getNPoints() > (1 << nd) * 2) {
-    // There is a check that the number of events is enough for it to make sense
-    // to do all this processing.
-    size_t numVertexes = 0;
-    auto vertexes = box->getVertexesArray(numVertexes);
-
-    // All vertexes have to be within THE SAME BIN = have the same linear index.
-    size_t lastLinearIndex = 0;
-    bool badOne = false;
-
-    for (size_t i = 0; i < numVertexes; i++) {
-      // Cache the center of the event (again for speed)
-      const coord_t *inCenter = vertexes.get() + i * nd;
+                            const size_t *const chunkMax,
+                            const BinTarget &target) {
+  if (box->getNPoints() == 0)
+    return;
+
+  // Boxes outside the range, or entirely within one bin, need not have their
+  // events looked at. This may save lots of time loading from disk.
+  size_t linearIndex = 0;
+  switch (placeBox(*box, chunkMin, chunkMax, linearIndex)) {
+  case BoxPlacement::Outside:
+    return;
+  case BoxPlacement::SingleBin:
+    // Add the CACHED signal from the entire box
+    target.signals[linearIndex] += box->getSignal();
+    target.errors[linearIndex] += box->getErrorSquared();
+    // TODO: If DataObjects get a weight, this would need to get the summed
+    // weight.
+    target.numEvents[linearIndex] += static_cast<signal_t>(box->getNPoints());
+    return;
+  case BoxPlacement::Spread:
+    break;
+  }
 
-      // Now transform to the output dimensions
-      m_transform->apply(inCenter, outCenter.data());
+  // The transformed coordinates of a batch of events, by output dimension
+  std::vector<coord_t> outCoords(m_outD * BATCH_SIZE);
+  const std::vector<MDE> &events = box->getConstEvents();
+  for (size_t first = 0; first < events.size(); first += BATCH_SIZE) {
+    const size_t batchSize = std::min(BATCH_SIZE, events.size() - first);
+    transformEvents<MDE, nd>(events.data() + first, batchSize,
+                             outCoords.data());
 
+    for (size_t i = 0; i < batchSize; ++i) {
       // To build up the linear index
       size_t linearIndex = 0;
-      // To mark VERTEXES outside range
-      badOne = false;
+      // To mark events outside range
+      bool badOne = false;
 
       /// Loop through the dimensions on which we bin
       for (size_t bd = 0; bd < m_outD; bd++) {
         // What is the bin index in that dimension
-        coord_t x = outCenter[bd];
+        coord_t x = outCoords[bd * BATCH_SIZE + i];
         auto ix = size_t(x);
         // Within range (for this chunk)?
         if ((x >= 0) && (ix >= chunkMin[bd]) && (ix < chunkMax[bd])) {
@@ -144,77 +273,16 @@ inline void BinMD::binMDBox(MDBox<MDE, nd> *box, const size_t *const chunkMin,
         }
       } // (for each dim in MDHisto)
 
-      // Is the vertex at the same place as the last one?
       if (!badOne) {
-        if ((i > 0) && (linearIndex != lastLinearIndex)) {
-          // Change of index
-          badOne = true;
-          break;
-        }
-        lastLinearIndex = linearIndex;
-      }
-
-      // Was the vertex completely outside the range?
-      if (badOne)
-        break;
-    } // (for each vertex)
-
-    if (!badOne) {
-      // Yes, the entire box is within a single bin
-      //        std::cout << "Box at " << box->getExtentsStr() << " is within a
-      //        single bin.\n";
-      // Add the CACHED signal from the entire box
-      signals[lastLinearIndex] += box->getSignal();
-      errors[lastLinearIndex] += box->getErrorSquared();
-      // TODO: If DataObjects get a weight, this would need to get the summed
-      // weight.
-      numEvents[lastLinearIndex] += static_cast<signal_t>(box->getNPoints());
-
-      // And don't bother looking at each event. This may save lots of time
-      // loading from disk.
-      return;
-    }
-  }
-
-  // If you get here, you could not determine that the entire box was in the
-  // same bin.
-  // So you need to iterate through events.
-  const std::vector<MDE> &events = box->getConstEvents();
-  for (auto it = events.begin(); it != events.end(); ++it) {
-    // Cache the center of the event (again for speed)
-    const coord_t *inCenter = it->getCenter();
-
-    // Now transform to the output dimensions
-    m_transform->apply(inCenter, outCenter.data());
-
-    // To build up the linear index
-    size_t linearIndex = 0;
-    // To mark events outside range
-    bool badOne = false;
-
-    /// Loop through the dimensions on which we bin
-    for (size_t bd = 0; bd < m_outD; bd++) {
-      // What is the bin index in that dimension
-      coord_t x = outCenter[bd];
-      auto ix = size_t(x);
-      // Within range (for this chunk)?
-      if ((x >= 0) && (ix >= chunkMin[bd]) && (ix < chunkMax[bd])) {
-        // Build up the linear index
-        linearIndex += indexMultiplier[bd] * ix;
-      } else {
-        // Outside the range
-        badOne = true;
-        break;
+        const MDE &event = events[first + i];
+        // Sum the signals as doubles to preserve precision
+        target.signals[linearIndex] += static_cast<signal_t>(event.getSignal());
+        target.errors[linearIndex] +=
+            static_cast<signal_t>(event.getErrorSquared());
+        // TODO: If DataObjects get a weight, this would need to get the summed
+        // weight.
+        target.numEvents[linearIndex] += 1.0;
       }
-    } // (for each dim in MDHisto)
-
-    if (!badOne) {
-      // Sum the signals as doubles to preserve precision
-      signals[linearIndex] += static_cast<signal_t>(it->getSignal());
-      errors[linearIndex] += static_cast<signal_t>(it->getErrorSquared());
-      // TODO: If DataObjects get a weight, this would need to get the summed
-      // weight.
-      numEvents[linearIndex] += 1.0;
     }
   }
   // Done with the events list
@@ -247,12 +315,135 @@ void BinMD::binByIterating(typename MDEventWorkspace<MDE, nd>::sptr ws) {
   signals = outWS->mutableSignalArray();
   errors = outWS->mutableErrorSquaredArray();
   numEvents = outWS->mutableNumEventsArray();
+  cacheTransform();
 
   if (!m_accumulate) {
     // Start with signal/error/numEvents at 0.0
     outWS->setTo(0.0, 0.0, 0.0);
   }
 
+  // Do we actually do it in parallel?
+  bool doParallel = getProperty("Parallel");
+  // Not if file-backed!
+  if (bc->isFileBacked())
+    doParallel = false;
+
+  if (prog) {
+    prog->setNotifyStep(0.1);
+    prog->resetNumSteps(100, 0.00, 1.0);
+  }
+
+  // Each thread but the first needs arrays of its own the size of the output.
+  // Fall back on giving the threads separate slices of the output when they
+  // do not fit into half of the available memory.
+  const size_t numThreads =
+      doParallel ? static_cast<size_t>(PARALLEL_GET_MAX_THREADS) : 1;
+  const size_t arraysSize = 3 * sizeof(signal_t) * outWS->getNPoints();
+  if (numThreads == 1 ||
+      (numThreads - 1) * arraysSize <= MemoryStats().availMem() * 1024 / 2)
+    binWithThreadArrays<MDE, nd>(ws, numThreads);
+  else
+    binInChunks<MDE, nd>(ws, doParallel);
+
+  // Now the implicit function
+  if (implicitFunction) {
+    if (prog)
+      prog->report("Applying implicit function.");
+    signal_t nan = std::numeric_limits<signal_t>::quiet_NaN();
+    outWS->applyImplicitFunction(implicitFunction.get(), nan, nan);
+  }
+}
+
+//----------------------------------------------------------------------------------------------
+/** Bin the boxes in parallel, each thread adding to arrays of its own which
+ * are summed into the output at the end. The first thread adds to the output
+ * directly.
+ *
+ * @param ws :: MDEventWorkspace of the given type.
+ * @param numThreads :: the number of threads to bin with
+ */
+template <typename MDE, size_t nd>
+void BinMD::binWithThreadArrays(typename MDEventWorkspace<MDE, nd>::sptr ws,
+                                const size_t numThreads) {
+  std::vector<size_t> binMin(m_outD, 0);
+  std::vector<size_t> binMax(m_outD);
+  for (size_t bd = 0; bd < m_outD; bd++)
+    binMax[bd] = m_binDimensions[bd]->getNBins();
+
+  // Build an implicit function (it needs to be in the space of the
+  // MDEventWorkspace)
+  auto function =
+      this->getImplicitFunctionForChunk(binMin.data(), binMax.data());
+  // Leaf-only; no depth limit; with the implicit function passed to it.
+  std::vector<API::IMDNode *> boxes;
+  ws->getBox()->getBoxes(boxes, 1000, true, function.get());
+  // Sort boxes by file position IF file backed. This reduces seeking time,
+  // hopefully.
+  if (ws->getBoxController()->isFileBacked())
+    API::IMDNode::sortObjByID(boxes);
+  g_log.debug() << "Found " << boxes.size()
+                << " boxes within the implicit function.\n";
+  if (prog)
+    prog->setNumSteps(boxes.size());
+
+  const size_t numBins = outWS->getNPoints();
+  std::vector<std::vector<signal_t>> threadArrays(numThreads - 1);
+  std::vector<BinTarget> targets(numThreads,
+                                 BinTarget{signals, errors, numEvents});
+
+  PRAGMA_OMP(parallel for schedule(dynamic, 16) if (numThreads > 1))
+  for (int i = 0; i < int(boxes.size()); ++i) {
+    PARALLEL_START_INTERUPT_REGION
+    auto *box = dynamic_cast<MDBox<MDE, nd> *>(boxes[i]);
+    if (box && !box->getIsMasked()) {
+      const auto thread = static_cast<size_t>(PARALLEL_THREAD_NUMBER);
+      if (thread > 0 && threadArrays[thread - 1].empty()) {
+        auto &arrays = threadArrays[thread - 1];
+        arrays.resize(3 * numBins, 0.0);
+        targets[thread] = BinTarget{arrays.data(), arrays.data() + numBins,
+                                    arrays.data() + 2 * numBins};
+      }
+      this->binMDBox(box, binMin.data(), binMax.data(), targets[thread]);
+    }
+    // Progress reporting
+    if (prog)
+      prog->report();
+    PARALLEL_END_INTERUPT_REGION
+  }
+  PARALLEL_CHECK_INTERUPT_REGION
+
+  // Sum the arrays of the other threads into the output
+  std::vector<const signal_t *> partials;
+  for (const auto &arrays : threadArrays)
+    if (!arrays.empty())
+      partials.emplace_back(arrays.data());
+  if (partials.empty())
+    return;
+  PARALLEL_FOR_IF(numThreads > 1)
+  for (int64_t i = 0; i < static_cast<int64_t>(numBins); ++i) {
+    for (const auto *partial : partials) {
+      signals[i] += partial[i];
+      errors[i] += partial[numBins + i];
+      numEvents[i] += partial[2 * numBins + i];
+    }
+  }
+}
+
+//----------------------------------------------------------------------------------------------
+/** Bin the boxes in chunks along the first output dimension. There is no
+ * overlap between the chunks in the output workspace, so they can be binned
+ * in parallel without arrays of their own, at the cost of boxes spanning
+ * several chunks being visited once for each.
+ *
+ * @param ws :: MDEventWorkspace of the given type.
+ * @param doParallel :: run the chunks in parallel
+ */
+template <typename MDE, size_t nd>
+void BinMD::binInChunks(typename MDEventWorkspace<MDE, nd>::sptr ws,
+                        const bool doParallel) {
+  BoxController_sptr bc = ws->getBoxController();
+  const BinTarget target{signals, errors, numEvents};
+
   // The dimension (in the output workspace) along which we chunk for parallel
   // processing
   // TODO: Find the smartest dimension to chunk against
@@ -264,21 +455,11 @@ void BinMD::binByIterating(typename MDEventWorkspace<MDE, nd>::sptr ws) {
                           (PARALLEL_GET_MAX_THREADS * 2));
   if (chunkNumBins < 1)
     chunkNumBins = 1;
-
-  // Do we actually do it in parallel?
-  bool doParallel = getProperty("Parallel");
-  // Not if file-backed!
-  if (bc->isFileBacked())
-    doParallel = false;
   if (!doParallel)
     chunkNumBins = int(m_binDimensions[chunkDimension]->getNBins());
 
   // Total number of steps
   size_t progNumSteps = 0;
-  if (prog) {
-    prog->setNotifyStep(0.1);
-    prog->resetNumSteps(100, 0.00, 1.0);
-  }
 
   // Run the chunks in parallel. There is no overlap in the output workspace so
   // it is thread safe to write to it..
@@ -334,7 +515,7 @@ void BinMD::binByIterating(typename MDEventWorkspace<MDE, nd>::sptr ws) {
         auto *box = dynamic_cast<MDBox<MDE, nd> *>(boxe);
         // Perform the binning in this separate method.
         if (box && !box->getIsMasked())
-          this->binMDBox(box, chunkMin.data(), chunkMax.data());
+          this->binMDBox(box, chunkMin.data(), chunkMax.data(), target);
 
         // Progress reporting
         if (prog)
@@ -346,14 +527,6 @@ void BinMD::binByIterating(typename MDEventWorkspace<MDE, nd>::sptr ws) {
       PARALLEL_END_INTERUPT_REGION
     } // for each chunk in parallel
     PARALLEL_CHECK_INTERUPT_REGION
-
-    // Now the implicit function
-    if (implicitFunction) {
-      if (prog)
-        prog->report("Applying implicit function.");
-      signal_t nan = std::numeric_limits<signal_t>::quiet_NaN();
-      outWS->applyImplicitFunction(implicitFunction.get(), nan, nan);
-    }
 }
 
 //----------------------------------------------------------------------------------------------
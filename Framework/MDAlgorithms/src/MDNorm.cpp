@@ -17,6 +17,7 @@
 #include "MantidGeometry/Crystal/SpaceGroupFactory.h"
 #include "MantidGeometry/Crystal/SymmetryOperationFactory.h"
 #include "MantidGeometry/Instrument.h"
+#include "MantidGeometry/Instrument/DetectorInfo.h"
 #include "MantidGeometry/MDGeometry/HKL.h"
 #include "MantidGeometry/MDGeometry/MDFrameFactory.h"
 #include "MantidGeometry/MDGeometry/QSample.h"
@@ -57,6 +58,16 @@ constexpr double energyToK = 8.0 * M_PI * M_PI *
 static bool abs_compare(double a, double b) {
   return (std::fabs(a) < std::fabs(b));
 }
+
+// Indices [first, last) of the ascending bin boundaries that lie strictly
+// between a and b
+std::pair<size_t, size_t> boundariesBetween(const std::vector<double> &x,
+                                            double a, double b) {
+  const auto first = std::upper_bound(x.begin(), x.end(), std::min(a, b));
+  const auto last = std::lower_bound(first, x.end(), std::max(a, b));
+  return {static_cast<size_t>(std::distance(x.begin(), first)),
+          static_cast<size_t>(std::distance(x.begin(), last))};
+}
 } // namespace
 
 // Register the algorithm into the AlgorithmFactory
@@ -416,6 +427,9 @@ std::map<std::string, std::string> MDNorm::validateInputs() {
 /** Execute the algorithm.
  */
 void MDNorm::exec() {
+  // The trajectories cached by an earlier execution may come from other flux
+  // or solid angle workspaces
+  m_trajectories = {};
   convention = Kernel::ConfigService::Instance().getString("Q.convention");
   // symmetry operations
   std::string symOps = this->getProperty("SymmetryOperations");
@@ -476,6 +490,7 @@ void MDNorm::exec() {
   this->setProperty("OutputDataWorkspace", outputDataWS);
 
   m_numExptInfos = outputDataWS->getNumExperimentInfo();
+  cacheDimensionXValues();
   // loop over all experiment infos
   for (uint16_t expInfoIndex = 0; expInfoIndex < m_numExptInfos;
        expInfoIndex++) {
@@ -485,9 +500,8 @@ void MDNorm::exec() {
     const std::vector<coord_t> otherValues =
         getValuesFromOtherDimensions(skipNormalization, expInfoIndex);
 
-    cacheDimensionXValues();
-
     if (!skipNormalization) {
+      cacheDetectorTrajectories(m_inputWS->getExperimentInfo(expInfoIndex));
       size_t symmOpsIndex = 0;
       for (const auto &so : symmetryOps) {
         calculateNormalization(otherValues, so, expInfoIndex, symmOpsIndex);
@@ -501,6 +515,8 @@ void MDNorm::exec() {
     // if more than one experiment info, keep accumulating
     m_accumulate = true;
   }
+  // Do not keep the last experiment info alive after the execution
+  m_trajectories = {};
 
   IAlgorithm_sptr divideMD = createChildAlgorithm("DivideMD", 0.99, 1.);
   divideMD->setProperty("LHSWorkspace", outputDataWS);
@@ -1133,6 +1149,86 @@ void MDNorm::cacheDimensionXValues() {
   }
 }
 
+/**
+ * Caches the direction, solid angle and flux spectrum of every detector
+ * trajectory. None of these depend on the goniometer, so the cache is kept
+ * while the instrument geometry and spectrum mapping stay the same, as they
+ * usually do between the runs of a rotation scan.
+ * @param exptInfo - the experiment info about to be normalized
+ */
+void MDNorm::cacheDetectorTrajectories(
+    const API::ExperimentInfo_const_sptr &exptInfo) {
+  const auto &spectrumInfo = exptInfo->spectrumInfo();
+  const auto nSpectra = spectrumInfo.size();
+  if (m_trajectories.exptInfo) {
+    const auto &cachedInfo = *m_trajectories.exptInfo;
+    const auto &cachedSpectra = cachedInfo.spectrumInfo();
+    bool sameGeometry =
+        (cachedInfo.detectorInfo().isEquivalent(exptInfo->detectorInfo())) &&
+        (cachedSpectra.size() == nSpectra);
+    for (size_t i = 0; sameGeometry && i < nSpectra; ++i) {
+      sameGeometry = (cachedSpectra.spectrumDefinition(i) ==
+                      spectrumInfo.spectrumDefinition(i));
+    }
+    if (sameGeometry) {
+      // keep the spectrum info of the cached experiment info alive for the
+      // current one
+      m_trajectories.exptInfo = exptInfo;
+      return;
+    }
+  }
+
+  API::MatrixWorkspace_const_sptr solidAngleWS =
+      getProperty("SolidAngleWorkspace");
+  API::MatrixWorkspace_const_sptr integrFlux = getProperty("FluxWorkspace");
+  const detid2index_map solidAngDetToIdx =
+      (solidAngleWS != nullptr)
+          ? solidAngleWS->getDetectorIDToWorkspaceIndexMap()
+          : detid2index_map();
+  const detid2index_map fluxDetToIdx =
+      (m_diffraction) ? integrFlux->getDetectorIDToWorkspaceIndexMap()
+                      : detid2index_map();
+
+  auto &table = m_trajectories;
+  table.x.assign(nSpectra, 0.);
+  table.y.assign(nSpectra, 0.);
+  table.z.assign(nSpectra, 0.);
+  table.solidAngle.assign(nSpectra, 1.);
+  table.fluxIndex.assign(nSpectra, 0);
+  table.contributes.assign(nSpectra, 0);
+  table.exptInfo = exptInfo;
+
+  const auto ndets = static_cast<int64_t>(nSpectra);
+  PARALLEL_FOR_NO_WSP_CHECK()
+  for (int64_t i = 0; i < ndets; i++) {
+    if (!spectrumInfo.hasDetectors(i) || spectrumInfo.isMonitor(i) ||
+        spectrumInfo.isMasked(i)) {
+      continue;
+    }
+    const auto &detector = spectrumInfo.detector(i);
+    // If the detector is a group, this should be the ID of the first detector
+    const auto detID = detector.getID();
+    if (m_diffraction) {
+      auto index = fluxDetToIdx.find(detID);
+      if (index == fluxDetToIdx.end()) {
+        // masked detector in flux, but not in input workspace
+        continue;
+      }
+      table.fluxIndex[i] = index->second;
+    }
+    if (solidAngleWS != nullptr) {
+      table.solidAngle[i] =
+          solidAngleWS->y(solidAngDetToIdx.find(detID)->second)[0];
+    }
+    const double theta = detector.getTwoTheta(m_samplePos, m_beamDir);
+    const double phi = detector.getPhi();
+    table.x[i] = sin(theta) * cos(phi);
+    table.y[i] = sin(theta) * sin(phi);
+    table.z[i] = cos(theta);
+    table.contributes[i] = 1;
+  }
+}
+
 /**
  * Computed the normalization for the input workspace. Results are stored in
  * m_normWS
@@ -1165,23 +1261,28 @@ void MDNorm::calculateNormalization(const std::vector<coord_t> &otherValues,
   DblMatrix Qtransform = R * m_UB * soMatrix * m_W;
   Qtransform.Invert();
   const double protonCharge = currentExptInfo.run().getProtonCharge();
-  const auto &spectrumInfo = currentExptInfo.spectrumInfo();
-
-  // Mappings
-  const auto ndets = static_cast<int64_t>(spectrumInfo.size());
-  bool haveSA = false;
-  API::MatrixWorkspace_const_sptr solidAngleWS =
-      getProperty("SolidAngleWorkspace");
   API::MatrixWorkspace_const_sptr integrFlux = getProperty("FluxWorkspace");
-  if (solidAngleWS != nullptr) {
-    haveSA = true;
+
+  // Rotate the cached trajectories into HKL for this run and symmetry
+  // operation. Kept as a flat loop over the detectors so it vectorizes.
+  const auto &table = m_trajectories;
+  const auto ndets = static_cast<int64_t>(table.contributes.size());
+  const double sign = (convention == "Crystallography") ? -1. : 1.;
+  const V3D qin = Qtransform * V3D(0., 0., sign);
+  std::vector<double> qoutX(table.x.size()), qoutY(table.y.size()),
+      qoutZ(table.z.size());
+  const double *row0 = Qtransform[0], *row1 = Qtransform[1],
+               *row2 = Qtransform[2];
+  const double *dirX = table.x.data(), *dirY = table.y.data(),
+               *dirZ = table.z.data();
+  for (int64_t i = 0; i < ndets; i++) {
+    qoutX[i] =
+        sign * (row0[0] * dirX[i] + row0[1] * dirY[i] + row0[2] * dirZ[i]);
+    qoutY[i] =
+        sign * (row1[0] * dirX[i] + row1[1] * dirY[i] + row1[2] * dirZ[i]);
+    qoutZ[i] =
+        sign * (row2[0] * dirX[i] + row2[1] * dirY[i] + row2[2] * dirZ[i]);
   }
-  const detid2index_map solidAngDetToIdx =
-      (haveSA) ? solidAngleWS->getDetectorIDToWorkspaceIndexMap()
-               : detid2index_map();
-  const detid2index_map fluxDetToIdx =
-      (m_diffraction) ? integrFlux->getDetectorIDToWorkspaceIndexMap()
-                      : detid2index_map();
 
   const size_t vmdDims = (m_diffraction) ? 3 : 4;
   std::vector<std::atomic<signal_t>> signalArray(m_normWS->getNPoints());
@@ -1203,39 +1304,20 @@ PRAGMA_OMP(parallel for private(intersections, xValues, yValues, pos, posNew) if
 for (int64_t i = 0; i < ndets; i++) {
   PARALLEL_START_INTERUPT_REGION
 
-  if (!spectrumInfo.hasDetectors(i) || spectrumInfo.isMonitor(i) ||
-      spectrumInfo.isMasked(i)) {
+  if (!table.contributes[i]) {
     continue;
   }
-
-  const auto &detector = spectrumInfo.detector(i);
-  double theta = detector.getTwoTheta(m_samplePos, m_beamDir);
-  double phi = detector.getPhi();
-  // If the dtefctor is a group, this should be the ID of the first detector
-  const auto detID = detector.getID();
-
   // get the flux spectrum number
-  size_t wsIdx = 0;
-  if (m_diffraction) {
-    auto index = fluxDetToIdx.find(detID);
-    if (index != fluxDetToIdx.end()) {
-      wsIdx = index->second;
-    } else { // masked detector in flux, but not in input workspace
-      continue;
-    }
-  }
+  const size_t wsIdx = table.fluxIndex[i];
 
   // Intersections
-  this->calculateIntersections(intersections, theta, phi, Qtransform,
+  this->calculateIntersections(intersections, qin,
+                               V3D(qoutX[i], qoutY[i], qoutZ[i]),
                                lowValues[i], highValues[i]);
   if (intersections.empty())
     continue;
   // Get solid angle for this contribution
-  double solid = protonCharge;
-  if (haveSA) {
-    solid =
-        solidAngleWS->y(solidAngDetToIdx.find(detID)->second)[0] * protonCharge;
-  }
+  const double solid = table.solidAngle[i] * protonCharge;
   if (m_diffraction) {
     // -- calculate integrals for the intersection --
     // momentum values at intersections
@@ -1322,25 +1404,16 @@ m_accumulate = true;
  * Calculate the points of intersection for the given detector with cuboid
  * surrounding the detector position in HKL
  * @param intersections A list of intersections in HKL space
- * @param theta Polar angle withd detector
- * @param phi Azimuthal angle with detector
- * @param transform Matrix to convert frm Q_lab to HKL (2Pi*R *UB*W*SO)^{-1}
+ * @param qin Incident beam direction in HKL, (2Pi*R *UB*W*SO)^{-1} times the
+ * beam direction, negated for the Crystallography convention
+ * @param qout Scattered beam direction of the detector in HKL, transformed
+ * the same way
  * @param lowvalue The lowest momentum or energy transfer for the trajectory
  * @param highvalue The highest momentum or energy transfer for the trajectory
  */
 void MDNorm::calculateIntersections(
-    std::vector<std::array<double, 4>> &intersections, const double theta,
-    const double phi, const Kernel::DblMatrix &transform, double lowvalue,
-    double highvalue) {
-  V3D qout(sin(theta) * cos(phi), sin(theta) * sin(phi), cos(theta)),
-      qin(0., 0., 1);
-
-  qout = transform * qout;
-  qin = transform * qin;
-  if (convention == "Crystallography") {
-    qout *= -1;
-    qin *= -1;
-  }
+    std::vector<std::array<double, 4>> &intersections, const V3D &qin,
+    const V3D &qout, double lowvalue, double highvalue) {
   double kfmin, kfmax, kimin, kimax;
   if (m_diffraction) {
     kimin = lowvalue;
@@ -1374,19 +1447,19 @@ void MDNorm::calculateIntersections(
     double fmom = (kfmax - kfmin) / (hEnd - hStart);
     double fk = (kEnd - kStart) / (hEnd - hStart);
     double fl = (lEnd - lStart) / (hEnd - hStart);
-    for (size_t i = 0; i < hNBins; i++) {
+    // only the boundaries strictly between the end points are crossed
+    const auto crossed = boundariesBetween(m_hX, hStart, hEnd);
+    for (size_t i = crossed.first; i < crossed.second; i++) {
       double hi = m_hX[i];
-      if (((hStart - hi) * (hEnd - hi) < 0)) {
-        // if hi is between hStart and hEnd, then ki and li will be between
-        // kStart, kEnd and lStart, lEnd and momi will be between kfmin and
-        // kfmax
-        double ki = fk * (hi - hStart) + kStart;
-        double li = fl * (hi - hStart) + lStart;
-        if ((ki >= m_kX[0]) && (ki <= m_kX[kNBins - 1]) && (li >= m_lX[0]) &&
-            (li <= m_lX[lNBins - 1])) {
-          double momi = fmom * (hi - hStart) + kfmin;
-          intersections.push_back({{hi, ki, li, momi}});
-        }
+      // if hi is between hStart and hEnd, then ki and li will be between
+      // kStart, kEnd and lStart, lEnd and momi will be between kfmin and
+      // kfmax
+      double ki = fk * (hi - hStart) + kStart;
+      double li = fl * (hi - hStart) + lStart;
+      if ((ki >= m_kX[0]) && (ki <= m_kX[kNBins - 1]) && (li >= m_lX[0]) &&
+          (li <= m_lX[lNBins - 1])) {
+        double momi = fmom * (hi - hStart) + kfmin;
+        intersections.push_back({{hi, ki, li, momi}});
       }
     }
   }
@@ -1395,19 +1468,19 @@ void MDNorm::calculateIntersections(
     double fmom = (kfmax - kfmin) / (kEnd - kStart);
     double fh = (hEnd - hStart) / (kEnd - kStart);
     double fl = (lEnd - lStart) / (kEnd - kStart);
-    for (size_t i = 0; i < kNBins; i++) {
+    // only the boundaries strictly between the end points are crossed
+    const auto crossed = boundariesBetween(m_kX, kStart, kEnd);
+    for (size_t i = crossed.first; i < crossed.second; i++) {
       double ki = m_kX[i];
-      if (((kStart - ki) * (kEnd - ki) < 0)) {
-        // if ki is between kStart and kEnd, then hi and li will be between
-        // hStart, hEnd and lStart, lEnd and momi will be between kfmin and
-        // kfmax
-        double hi = fh * (ki - kStart) + hStart;
-        double li = fl * (ki - kStart) + lStart;
-        if ((hi >= m_hX[0]) && (hi <= m_hX[hNBins - 1]) && (li >= m_lX[0]) &&
-            (li <= m_lX[lNBins - 1])) {
-          double momi = fmom * (ki - kStart) + kfmin;
-          intersections.push_back({{hi, ki, li, momi}});
-        }
+      // if ki is between kStart and kEnd, then hi and li will be between
+      // hStart, hEnd and lStart, lEnd and momi will be between kfmin and
+      // kfmax
+      double hi = fh * (ki - kStart) + hStart;
+      double li = fl * (ki - kStart) + lStart;
+      if ((hi >= m_hX[0]) && (hi <= m_hX[hNBins - 1]) && (li >= m_lX[0]) &&
+          (li <= m_lX[lNBins - 1])) {
+        double momi = fmom * (ki - kStart) + kfmin;
+        intersections.push_back({{hi, ki, li, momi}});
       }
     }
   }
@@ -1418,32 +1491,36 @@ void MDNorm::calculateIntersections(
     double fh = (hEnd - hStart) / (lEnd - lStart);
     double fk = (kEnd - kStart) / (lEnd - lStart);
 
-    for (size_t i = 0; i < lNBins; i++) {
+    // only the boundaries strictly between the end points are crossed
+    const auto crossed = boundariesBetween(m_lX, lStart, lEnd);
+    for (size_t i = crossed.first; i < crossed.second; i++) {
       double li = m_lX[i];
-      if (((lStart - li) * (lEnd - li) < 0)) {
-        double hi = fh * (li - lStart) + hStart;
-        double ki = fk * (li - lStart) + kStart;
-        if ((hi >= m_hX[0]) && (hi <= m_hX[hNBins - 1]) && (ki >= m_kX[0]) &&
-            (ki <= m_kX[kNBins - 1])) {
-          double momi = fmom * (li - lStart) + kfmin;
-          intersections.push_back({{hi, ki, li, momi}});
-        }
+      double hi = fh * (li - lStart) + hStart;
+      double ki = fk * (li - lStart) + kStart;
+      if ((hi >= m_hX[0]) && (hi <= m_hX[hNBins - 1]) && (ki >= m_kX[0]) &&
+          (ki <= m_kX[kNBins - 1])) {
+        double momi = fmom * (li - lStart) + kfmin;
+        intersections.push_back({{hi, ki, li, momi}});
       }
     }
   }
   // intersections with dE
-  if (!m_dEIntegrated) {
-    for (size_t i = 0; i < eNBins; i++) {
-      double kfi = m_eX[i];
-      if ((kfi - kfmin) * (kfi - kfmax) <= 0) {
-        double h = qin.X() * kimin - qout.X() * kfi;
-        double k = qin.Y() * kimin - qout.Y() * kfi;
-        double l = qin.Z() * kimin - qout.Z() * kfi;
-        if ((h >= m_hX[0]) && (h <= m_hX[hNBins - 1]) && (k >= m_kX[0]) &&
-            (k <= m_kX[kNBins - 1]) && (l >= m_lX[0]) &&
-            (l <= m_lX[lNBins - 1])) {
-          intersections.push_back({{h, k, l, kfi}});
-        }
+  if (!m_dEIntegrated && !std::isnan(kfmin) && !std::isnan(kfmax)) {
+    // the cached final momenta decrease along the energy transfer axis
+    const auto first =
+        std::lower_bound(m_eX.begin(), m_eX.end(), std::max(kfmin, kfmax),
+                         std::greater<double>());
+    const auto last = std::upper_bound(
+        first, m_eX.end(), std::min(kfmin, kfmax), std::greater<double>());
+    for (auto kfIt = first; kfIt != last; ++kfIt) {
+      double kfi = *kfIt;
+      double h = qin.X() * kimin - qout.X() * kfi;
+      double k = qin.Y() * kimin - qout.Y() * kfi;
+      double l = qin.Z() * kimin - qout.Z() * kfi;
+      if ((h >= m_hX[0]) && (h <= m_hX[hNBins - 1]) && (k >= m_kX[0]) &&
+          (k <= m_kX[kNBins - 1]) && (l >= m_lX[0]) &&
+          (l <= m_lX[lNBins - 1])) {
+        intersections.push_back({{h, k, l, kfi}});
       }
     }
   }
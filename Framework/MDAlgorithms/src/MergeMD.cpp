@@ -13,6 +13,8 @@
 #include "MantidKernel/MandatoryValidator.h"
 #include "MantidKernel/Strings.h"
 
+#include <algorithm>
+
 using namespace Mantid::Kernel;
 using namespace Mantid::API;
 using namespace Mantid::Geometry;
@@ -116,30 +118,68 @@ void MergeMD::createOutputWorkspace(std::vector<std::string> &inputs) {
     }
   }
 
-  // OK, now create the blank MDWorkspace
-
-  // Have the factory create it
-  out = MDEventFactory::CreateMDWorkspace(numDims, ws0->getEventTypeName());
-  out->setDisplayNormalization(displNorm);
-  out->setDisplayNormalizationHisto(displNormH);
+  // A workspace cannot be appended to itself in place
+  if (m_inPlace && std::find(m_workspaces.begin() + 1, m_workspaces.end(),
+                             m_workspaces[0]) != m_workspaces.end())
+    m_inPlace = false;
+
+  // Appending in place would keep the events in the masked boxes of the first
+  // workspace, which are left out of a new workspace
+  if (m_inPlace) {
+    std::vector<API::IMDNode *> boxes;
+    m_workspaces[0]->getBoxes(boxes, 1000, true);
+    if (std::any_of(boxes.cbegin(), boxes.cend(), [](const API::IMDNode *box) {
+          return box->getIsMasked();
+        })) {
+      g_log.information() << ws0->getName()
+                          << " has masked boxes, so a new workspace is "
+                             "created rather than appending to it in place.\n";
+      m_inPlace = false;
+    }
+  }
 
-  // Give all the dimensions
-  for (size_t d = 0; d < numDims; d++) {
+  // Appending in place keeps the extents of the first workspace, so the
+  // others must lie within them
+  for (size_t d = 0; m_inPlace && d < numDims; d++) {
     IMDDimension_const_sptr dim0 = ws0->getDimension(d);
-    MDHistoDimension *dim = new MDHistoDimension(
-        dim0->getName(), dim0->getDimensionId(), dim0->getMDFrame(), dimMin[d],
-        dimMax[d], dim0->getNBins());
-    out->addDimension(MDHistoDimension_sptr(dim));
+    if (dimMin[d] < dim0->getMinimum() || dimMax[d] > dim0->getMaximum()) {
+      g_log.information() << "The workspaces extend beyond dimension "
+                          << dim0->getName() << " of " << ws0->getName()
+                          << ", so a new workspace is created rather than "
+                             "appending to it in place.\n";
+      m_inPlace = false;
+    }
   }
 
-  // Initialize it using the dimension
-  out->initialize();
+  if (m_inPlace) {
+    // Append to the first workspace, keeping its box structure
+    out = m_workspaces[0];
+  } else {
+    // OK, now create the blank MDWorkspace
 
-  // Set the box controller settings from the properties
-  this->setBoxController(out->getBoxController());
+    // Have the factory create it
+    out = MDEventFactory::CreateMDWorkspace(numDims, ws0->getEventTypeName());
+    out->setDisplayNormalization(displNorm);
+    out->setDisplayNormalizationHisto(displNormH);
+
+    // Give all the dimensions
+    for (size_t d = 0; d < numDims; d++) {
+      IMDDimension_const_sptr dim0 = ws0->getDimension(d);
+      MDHistoDimension *dim = new MDHistoDimension(
+          dim0->getName(), dim0->getDimensionId(), dim0->getMDFrame(),
+          dimMin[d], dimMax[d], dim0->getNBins());
+      out->addDimension(MDHistoDimension_sptr(dim));
+    }
 
-  // Perform the initial box splitting
-  out->splitBox();
+    // Initialize it using the dimension
+    out->initialize();
+
+    // Set the box controller settings from the properties
+    this->setBoxController(out->getBoxController());
+
+    // Perform the initial box splitting
+    out->splitBox();
+  }
 
   // copy experiment infos
   uint16_t nExperiments(0);
@@ -152,6 +192,9 @@ void MergeMD::createOutputWorkspace(std::vector<std::string> &inputs) {
   for (uint16_t i = 0; i < nExperiments; i++) {
     uint16_t nWSexperiments = m_workspaces[i]->getNumExperimentInfo();
     experimentInfoNo.emplace_back(nWSexperiments);
+    // The first workspace already holds its own when appending in place
+    if (m_inPlace && i == 0)
+      continue;
     for (uint16_t j = 0; j < nWSexperiments; j++) {
       API::ExperimentInfo_sptr ei = API::ExperimentInfo_sptr(
           m_workspaces[i]->getExperimentInfo(j)->cloneExperimentInfo());
@@ -213,7 +256,6 @@ void MergeMD::doPlus(typename MDEventWorkspace<MDE, nd>::sptr ws2) {
   if (!ws1 || !ws2)
     throw std::runtime_error("Incompatible workspace types passed to MergeMD.");
 
-  MDBoxBase<MDE, nd> *box1 = ws1->getBox();
   MDBoxBase<MDE, nd> *box2 = ws2->getBox();
 
   uint16_t runIndexOffset = experimentInfoNo.back();
@@ -232,14 +274,19 @@ void MergeMD::doPlus(typename MDEventWorkspace<MDE, nd>::sptr ws2) {
   if (ws2->isFileBacked())
     fileBasedSource = true;
 
+  // The boxes of WS1 receiving events, tracked by each thread, so that only
+  // those are considered for splitting
+  std::vector<std::vector<API::IMDNode *>> touched(PARALLEL_GET_MAX_THREADS);
+
   // Add the boxes in parallel. They should be spread out enough on each
   // core to avoid stepping on each other.
   // cppcheck-suppress syntaxError
-    PRAGMA_OMP( parallel for if (!ws2->isFileBacked()) )
+    PRAGMA_OMP( parallel for if (!ws2->isFileBacked() && !ws1->isFileBacked()) )
     for (int i = 0; i < numBoxes; i++) {
       PARALLEL_START_INTERUPT_REGION
       auto *box = dynamic_cast<MDBox<MDE, nd> *>(boxes[i]);
       if (box && !box->getIsMasked()) {
+        auto &threadTouched = touched[PARALLEL_THREAD_NUMBER];
         // Copy the events from WS2 and add them into WS1
         const std::vector<MDE> &events = box->getConstEvents();
         // Add events, with bounds checking
@@ -249,8 +296,12 @@ void MergeMD::doPlus(typename MDEventWorkspace<MDE, nd>::sptr ws2) {
           MDE newEvent(it->getSignal(), it->getErrorSquared(), it->getCenter());
           // Copy extra data, if any
           copyEvent(*it, newEvent, runIndexOffset);
-          // Add it to the workspace
-          box1->addEvent(newEvent);
+          // Add it to the workspace. Events of one box mostly go to the same
+          // box of WS1, so only record a change of box
+          API::IMDNode *target = ws1->addTrackedEvent(newEvent);
+          if (target &&
+              (threadTouched.empty() || threadTouched.back() != target))
+            threadTouched.emplace_back(target);
         }
         if (fileBasedSource)
           box->clear();
@@ -265,7 +316,13 @@ void MergeMD::doPlus(typename MDEventWorkspace<MDE, nd>::sptr ws2) {
     Progress *prog2 = nullptr;
     ThreadScheduler *ts = new ThreadSchedulerFIFO();
     ThreadPool tp(ts, 0, prog2);
-    ws1->splitAllIfNeeded(ts);
+    std::vector<API::IMDNode *> touchedBoxes;
+    for (const auto &threadTouched : touched)
+      touchedBoxes.insert(touchedBoxes.end(), threadTouched.begin(),
+                          threadTouched.end());
+    ws1->splitTrackedBoxes(touchedBoxes, ts);
+    g_log.debug() << touchedBoxes.size() << " boxes received events from "
+                  << ws2->getName() << '\n';
     // prog2->resetNumSteps( ts->size(), 0.4, 0.6);
     tp.joinAll();
 
@@ -304,12 +361,20 @@ void MergeMD::exec() {
     throw std::invalid_argument("Only one input workspace specified");
   }
 
+  // Append in place when the output replaces the first input
+  m_inPlace = (getPropertyValue("OutputWorkspace") == inputs.front());
+
   // Create a blank output workspace
   this->createOutputWorkspace(inputs);
 
+  // The first workspace is the output when appending in place
+  const size_t firstToAdd = m_inPlace ? 1 : 0;
+  if (m_inPlace)
+    experimentInfoNo.pop_back();
+
   // Run PlusMD on each of the input workspaces, in order.
   double progStep = 1.0 / double(m_workspaces.size());
-  for (size_t i = 0; i < m_workspaces.size(); i++) {
+  for (size_t i = firstToAdd; i < m_workspaces.size(); i++) {
     g_log.information() << "Adding workspace " << m_workspaces[i]->getName()
                         << '\n';
     progress(double(i) * progStep, m_workspaces[i]->getName());
@@ -319,6 +384,14 @@ void MergeMD::exec() {
   this->progress(0.95, "Refreshing cache");
   out->refreshCache();
 
+  if (m_inPlace && out->isFileBacked()) {
+    // Write the appended events and the new boxes into the existing file
+    auto savemd = this->createChildAlgorithm("SaveMD", 0.95, 1.0);
+    savemd->setProperty("InputWorkspace", out);
+    savemd->setProperty("UpdateFileBackEnd", true);
+    savemd->executeAsChildAlg();
+  }
+
   this->setProperty("OutputWorkspace", out);
 
   g_log.debug() << tim << " to merge all workspaces.\n";
@@ -1009,6 +1009,39 @@ public:
                binned->allBasisNormalized());
   }
 
+  void test_parallel_binning_matches_serial() {
+    auto in_ws = MDEventsTestHelper::makeMDEW<3>(10, 0.0, 10.0, 0);
+    in_ws->getBoxController()->setSplitThreshold(100);
+    in_ws->splitAllIfNeeded(nullptr);
+    AnalysisDataService::Instance().addOrReplace("BinMDTest_ws", in_ws);
+    FrameworkManager::Instance().exec("FakeMDEventData", 4, "InputWorkspace",
+                                      "BinMDTest_ws", "UniformParams",
+                                      "100000");
+    in_ws->refreshCache();
+
+    for (const bool axisAligned : {true, false}) {
+      auto serial = binFakeData(axisAligned, false);
+      auto parallel = binFakeData(axisAligned, true);
+      TS_ASSERT(serial && parallel);
+      if (!serial || !parallel)
+        break;
+      TS_ASSERT_EQUALS(serial->getNPoints(), 17 * 13 * 3);
+      TS_ASSERT_EQUALS(parallel->getNPoints(), serial->getNPoints());
+      double total = 0;
+      for (size_t i = 0; i < serial->getNPoints(); ++i) {
+        TS_ASSERT_DELTA(parallel->getSignalAt(i), serial->getSignalAt(i),
+                        1e-9);
+        TS_ASSERT_DELTA(parallel->getErrorAt(i), serial->getErrorAt(i), 1e-9);
+        TS_ASSERT_DELTA(parallel->getNumEventsAt(i), serial->getNumEventsAt(i),
+                        1e-9);
+        total += serial->getNumEventsAt(i);
+      }
+      // Most of the events are within the output extents
+      TS_ASSERT(total > 50000 && total < 100000);
+    }
+    AnalysisDataService::Instance().remove("BinMDTest_ws");
+  }
+
   void test_filebackend_and_unrecognised_instrument() {
     // The algorithm should still successfully execute, even if the workspace is
     // file-backed and the named instrument doesn't exist
@@ -1100,6 +1133,33 @@ public:
 
     return filename;
   }
+
+  /// Bin the workspace in the ADS, rotated by 0.1 rad if not axis aligned
+  MDHistoWorkspace_sptr binFakeData(const bool axisAligned,
+                                    const bool parallel) {
+    BinMD alg;
+    alg.setChild(true);
+    alg.initialize();
+    alg.setPropertyValue("InputWorkspace", "BinMDTest_ws");
+    alg.setProperty("AxisAligned", axisAligned);
+    if (axisAligned) {
+      alg.setPropertyValue("AlignedDim0", "Axis0,1.0,9.0,17");
+      alg.setPropertyValue("AlignedDim1", "Axis1,1.0,9.0,13");
+      alg.setPropertyValue("AlignedDim2", "Axis2,0.0,10.0,3");
+    } else {
+      alg.setPropertyValue("BasisVector0", "OutX,m,0.995,0.0998,0");
+      alg.setPropertyValue("BasisVector1", "OutY,m,-0.0998,0.995,0");
+      alg.setPropertyValue("BasisVector2", "OutZ,m,0,0,1");
+      alg.setPropertyValue("Translation", "1,0.5,0");
+      alg.setPropertyValue("OutputExtents", "0,8, 0,8, 0,10");
+      alg.setProperty("OutputBins", std::vector<int>{17, 13, 3});
+    }
+    alg.setProperty("Parallel", parallel);
+    alg.setPropertyValue("OutputWorkspace", "BinMDTest_out");
+    TS_ASSERT_THROWS_NOTHING(alg.execute());
+    Workspace_sptr out = alg.getProperty("OutputWorkspace");
+    return std::dynamic_pointer_cast<MDHistoWorkspace>(out);
+  }
 };
 
 class BinMDTestPerformance : public CxxTest::TestSuite {
@@ -1130,7 +1190,8 @@ public:
     AnalysisDataService::Instance().remove("BinMDTest_ws");
   }
 
-  void do_test(const std::string &binParams, bool IterateEvents) {
+  void do_test(const std::string &binParams, bool IterateEvents,
+               bool Parallel = false) {
     BinMD alg;
     TS_ASSERT_THROWS_NOTHING(alg.initialize())
     TS_ASSERT(alg.isInitialized())
@@ -1144,6 +1205,7 @@ public:
         alg.setPropertyValue("AlignedDim2", "Axis2," + binParams));
     TS_ASSERT_THROWS_NOTHING(alg.setPropertyValue("AlignedDim3", ""));
     TS_ASSERT_THROWS_NOTHING(alg.setProperty("IterateEvents", IterateEvents));
+    TS_ASSERT_THROWS_NOTHING(alg.setProperty("Parallel", Parallel));
     TS_ASSERT_THROWS_NOTHING(
         alg.setPropertyValue("OutputWorkspace", "BinMDTest_ws_histo"));
     TS_ASSERT_THROWS_NOTHING(alg.execute();)
@@ -1155,6 +1217,11 @@ public:
       do_test("2.0,8.0, 60", true);
   }
 
+  void test_3D_60cube_IterateEvents_Parallel() {
+    for (size_t i = 0; i < 1; i++)
+      do_test("2.0,8.0, 60", true, true);
+  }
+
   void test_3D_tinyRegion_60cube_IterateEvents() {
     for (size_t i = 0; i < 1; i++)
       do_test("5.3,5.4, 60", true);
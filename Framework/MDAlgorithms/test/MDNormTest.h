@@ -0,0 +1,255 @@
+// Mantid Repository : https://github.com/mantidproject/mantid
+//
+// Copyright &copy; 2020 ISIS Rutherford Appleton Laboratory UKRI,
+//   NScD Oak Ridge National Laboratory, European Spallation Source,
+//   Institut Laue - Langevin & CSNS, Institute of High Energy Physics, CAS
+// SPDX - License - Identifier: GPL - 3.0 +
+#pragma once
+
+#include "MantidAPI/IMDEventWorkspace.h"
+#include "MantidAPI/IMDHistoWorkspace.h"
+#include "MantidAPI/Run.h"
+#include "MantidGeometry/Instrument/DetectorInfo.h"
+#include "MantidGeometry/Instrument/Goniometer.h"
+#include "MantidGeometry/MDGeometry/QSample.h"
+#include "MantidMDAlgorithms/CreateMDWorkspace.h"
+#include "MantidMDAlgorithms/MDNorm.h"
+#include "MantidTestHelpers/ComponentCreationHelper.h"
+#include "MantidTestHelpers/WorkspaceCreationHelper.h"
+#include <cxxtest/TestSuite.h>
+
+using Mantid::MDAlgorithms::MDNorm;
+using namespace Mantid::API;
+using namespace Mantid::Geometry;
+
+class MDNormTest : public CxxTest::TestSuite {
+public:
+  // This pair of boilerplate methods prevent the suite being created statically
+  // This means the constructor isn't called when running other tests
+  static MDNormTest *createSuite() { return new MDNormTest(); }
+  static void destroySuite(MDNormTest *suite) { delete suite; }
+
+  void test_Init() {
+    MDNorm alg;
+    TS_ASSERT_THROWS_NOTHING(alg.initialize())
+    TS_ASSERT(alg.isInitialized())
+  }
+
+  void test_rotation_scan_matches_runs_normalized_on_their_own() {
+    // The runs share the detector trajectories cached for the first run
+    checkSumOfRuns(rotationScan(), false);
+  }
+
+  void test_inelastic_rotation_scan_matches_runs_normalized_on_their_own() {
+    checkSumOfRuns(rotationScan(), true);
+  }
+
+  void test_masking_change_between_runs_invalidates_cached_trajectories() {
+    // Same goniometer and proton charge, so only the mask differs
+    const std::vector<RunSetup> runs{{20., 1., {}}, {20., 1., {1, 3}}};
+    for (const bool inelastic : {false, true}) {
+      const auto norm = checkSumOfRuns(runs, inelastic);
+      const auto unmasked = normalize(createWorkspace({runs[0]}, inelastic));
+      const auto masked = normalize(createWorkspace({runs[1]}, inelastic));
+      TS_ASSERT_LESS_THAN(total(*masked), total(*unmasked));
+      TS_ASSERT_LESS_THAN(total(*norm), 2. * total(*unmasked));
+    }
+  }
+
+  void test_execute_again_with_other_solid_angles() {
+    // The trajectories cached by the first execution hold its solid angles
+    MDNorm alg;
+    setUpNormalization(alg, createWorkspace(rotationScan(), false));
+    const auto first = execute(alg);
+    auto solidAngle = createDetectorWorkspace(1);
+    for (size_t i = 0; i < NUM_DETECTORS; ++i)
+      solidAngle->mutableY(i)[0] *= 2.;
+    alg.setProperty("SolidAngleWorkspace", solidAngle);
+    const auto second = execute(alg);
+    TS_ASSERT(first && second);
+    if (!first || !second)
+      return;
+    TS_ASSERT_LESS_THAN(0., total(*first));
+    TS_ASSERT_DELTA(total(*second), 2. * total(*first), 1e-9 * total(*first));
+  }
+
+  void test_inelastic_energy_transfer_bins() {
+    // Every trajectory covers the whole energy transfer binning inside the Q
+    // box, so each bin holds its width times the solid angle and proton
+    // charge of every detector, found only if every boundary is crossed
+    const std::vector<RunSetup> runs{{0., 1., {}}, {45., 2., {4}}};
+    const auto norm = normalize(createWorkspace(runs, true));
+    TS_ASSERT(norm);
+    if (!norm)
+      return;
+    std::vector<double> energyBins(8, 0.);
+    for (size_t i = 0; i < norm->getNPoints(); ++i) {
+      const auto deltaE = norm->getCenter(i)[3];
+      energyBins[static_cast<size_t>(std::floor(deltaE + 1.))] +=
+          norm->getSignalAt(i);
+    }
+    const double expected = NUM_DETECTORS * 1. + (NUM_DETECTORS - 1) * 2.;
+    for (const auto bin : energyBins)
+      TS_ASSERT_DELTA(bin, expected, 1e-6);
+  }
+
+private:
+  struct RunSetup {
+    /// Goniometer rotation around the vertical axis, in degrees
+    double angle;
+    double protonCharge;
+    /// Detector indices masked in this run
+    std::vector<size_t> masked;
+  };
+
+  static constexpr size_t NUM_DETECTORS = 5;
+
+  std::vector<RunSetup> rotationScan() {
+    return {{0., 1., {}}, {30., 2., {}}, {60., 3., {}}};
+  }
+
+  Instrument_sptr createInstrument() {
+    const std::vector<double> L2(NUM_DETECTORS, 1.),
+        polar{0.3, 0.6, 0.9, 1.2, 1.5}, azimuthal{0., 0.5, 1., 1.5, 2.};
+    return ComponentCreationHelper::createCylInstrumentWithDetInGivenPositions(
+        L2, polar, azimuthal);
+  }
+
+  /// An empty MD workspace in Q_sample with an experiment info for each run
+  IMDEventWorkspace_sptr createWorkspace(const std::vector<RunSetup> &runs,
+                                         const bool inelastic) {
+    Mantid::MDAlgorithms::CreateMDWorkspace create;
+    create.setChild(true);
+    create.initialize();
+    const std::string qSample = QSample::QSampleName;
+    if (inelastic) {
+      create.setProperty("Dimensions", "4");
+      create.setPropertyValue("Extents", "-10,10,-10,10,-10,10,-5,10");
+      create.setPropertyValue("Frames", qSample + "," + qSample + "," +
+                                            qSample + ",General Frame");
+      create.setPropertyValue("Names", "Q_sample_x,Q_sample_y,Q_sample_z,"
+                                       "DeltaE");
+      create.setPropertyValue("Units", "U,U,U,DeltaE");
+    } else {
+      create.setProperty("Dimensions", "3");
+      create.setPropertyValue("Extents", "-10,10,-10,10,-10,10");
+      create.setPropertyValue("Frames",
+                              qSample + "," + qSample + "," + qSample);
+      create.setPropertyValue("Names", "Q_sample_x,Q_sample_y,Q_sample_z");
+      create.setPropertyValue("Units", "U,U,U");
+    }
+    create.setPropertyValue("OutputWorkspace", "md");
+    create.execute();
+    IMDEventWorkspace_sptr ws = create.getProperty("OutputWorkspace");
+
+    const auto instrument = createInstrument();
+    // The trajectories are energy transfers for inelastic data and momenta
+    // for diffraction
+    const std::vector<double> low(NUM_DETECTORS, inelastic ? -2. : 1.);
+    const std::vector<double> high(NUM_DETECTORS, inelastic ? 8. : 4.);
+    for (const auto &run : runs) {
+      auto ei = std::make_shared<ExperimentInfo>();
+      ei->setInstrument(instrument);
+      auto &detectorInfo = ei->mutableDetectorInfo();
+      for (const auto index : run.masked)
+        detectorInfo.setMasked(index, true);
+      ei->mutableRun().mutableGoniometer().pushAxis("omega", 0., 1., 0.,
+                                                    run.angle);
+      ei->mutableRun().setProtonCharge(run.protonCharge);
+      ei->mutableRun().addProperty("Ei", 10.);
+      ei->mutableRun().addProperty("MDNorm_low", low);
+      ei->mutableRun().addProperty("MDNorm_high", high);
+      ws->addExperimentInfo(ei);
+    }
+    return ws;
+  }
+
+  /// A workspace with one spectrum per detector, mapped by detector ID
+  MatrixWorkspace_sptr createDetectorWorkspace(const size_t numPoints) {
+    auto ws = WorkspaceCreationHelper::create2DWorkspacePoints(
+        NUM_DETECTORS, numPoints, 0., 1.);
+    ws->setInstrument(createInstrument());
+    for (size_t i = 0; i < NUM_DETECTORS; ++i) {
+      ws->getSpectrum(i).setDetectorID(static_cast<Mantid::detid_t>(i + 1));
+      // integrated flux grows with the momentum; the solid angle differs
+      // between detectors
+      auto &y = ws->mutableY(i);
+      for (size_t j = 0; j < numPoints; ++j)
+        y[j] = (numPoints > 1) ? ws->x(i)[j] : 0.1 * static_cast<double>(i + 1);
+    }
+    return ws;
+  }
+
+  void setUpNormalization(MDNorm &alg, const IMDEventWorkspace_sptr &inputWS) {
+    const bool inelastic = inputWS->getNumDims() > 3;
+    alg.setChild(true);
+    alg.initialize();
+    alg.setProperty("InputWorkspace", inputWS);
+    alg.setProperty("RLU", false);
+    const std::string qBinning = inelastic ? "-6,0.5,6" : "-8,0.5,8";
+    alg.setPropertyValue("Dimension0Binning", qBinning);
+    alg.setPropertyValue("Dimension1Binning", qBinning);
+    alg.setPropertyValue("Dimension2Binning", qBinning);
+    if (inelastic) {
+      alg.setPropertyValue("Dimension3Name", "DeltaE");
+      alg.setPropertyValue("Dimension3Binning", "-1,1,7");
+    } else {
+      alg.setProperty("SolidAngleWorkspace", createDetectorWorkspace(1));
+      alg.setProperty("FluxWorkspace", createDetectorWorkspace(11));
+    }
+    alg.setPropertyValue("OutputWorkspace", "result");
+    alg.setPropertyValue("OutputDataWorkspace", "data");
+    alg.setPropertyValue("OutputNormalizationWorkspace", "norm");
+  }
+
+  IMDHistoWorkspace_sptr normalize(const IMDEventWorkspace_sptr &inputWS) {
+    MDNorm alg;
+    setUpNormalization(alg, inputWS);
+    return execute(alg);
+  }
+
+  IMDHistoWorkspace_sptr execute(MDNorm &alg) {
+    TS_ASSERT_THROWS_NOTHING(alg.execute());
+    TS_ASSERT(alg.isExecuted());
+    Workspace_sptr norm = alg.getProperty("OutputNormalizationWorkspace");
+    return std::dynamic_pointer_cast<IMDHistoWorkspace>(norm);
+  }
+
+  double total(const IMDHistoWorkspace &ws) {
+    double sum = 0.;
+    for (size_t i = 0; i < ws.getNPoints(); ++i)
+      sum += ws.getSignalAt(i);
+    return sum;
+  }
+
+  /** Check that normalizing the runs together gives the sum of normalizing
+   * each run in a workspace of its own, without a cache from other runs
+   * @return the normalization of the runs together
+   */
+  IMDHistoWorkspace_sptr checkSumOfRuns(const std::vector<RunSetup> &runs,
+                                        const bool inelastic) {
+    const auto norm = normalize(createWorkspace(runs, inelastic));
+    TS_ASSERT(norm);
+    if (!norm)
+      return norm;
+    std::vector<double> sum(norm->getNPoints(), 0.);
+    std::vector<IMDHistoWorkspace_sptr> single;
+    for (const auto &run : runs) {
+      single.emplace_back(normalize(createWorkspace({run}, inelastic)));
+      TS_ASSERT_EQUALS(single.back()->getNPoints(), sum.size());
+      for (size_t i = 0; i < sum.size(); ++i)
+        sum[i] += single.back()->getSignalAt(i);
+    }
+    // the runs normalize differently, so the bins must be compared
+    TS_ASSERT_LESS_THAN(0., total(*norm));
+    size_t numDifferent = 0;
+    for (size_t i = 0; i < sum.size(); ++i) {
+      TS_ASSERT_DELTA(norm->getSignalAt(i), sum[i], 1e-9 * (1. + sum[i]));
+      if (std::abs(single.front()->getSignalAt(i) -
+                   single.back()->getSignalAt(i)) > 1e-9)
+        ++numDifferent;
+    }
+    TS_ASSERT_LESS_THAN(0, numDifferent);
+    return norm;
+  }
+};
@@ -9,7 +9,9 @@
 #include "MantidAPI/FrameworkManager.h"
 #include "MantidDataObjects/MDEventFactory.h"
 #include "MantidGeometry/MDGeometry/IMDDimension.h"
+#include "MantidMDAlgorithms/LoadMD.h"
 #include "MantidMDAlgorithms/MergeMD.h"
+#include "MantidMDAlgorithms/SaveMD2.h"
 #include "MantidTestHelpers/MDEventsTestHelper.h"
 
 #include <cxxtest/TestSuite.h>
@@ -103,6 +105,146 @@ public:
     AnalysisDataService::Instance().remove(outWSName);
   }
 
+  void test_append_in_place() {
+    makeAnyMDEW<MDLeanEvent<2>, 2>(5, 0., 10., 1, "ws_inside");
+    auto ws0 =
+        AnalysisDataService::Instance().retrieveWS<IMDEventWorkspace>("ws0");
+    const auto numBoxes = ws0->getBoxController()->getTotalNumMDBoxes();
+
+    MergeMD alg;
+    TS_ASSERT_THROWS_NOTHING(alg.initialize())
+    TS_ASSERT_THROWS_NOTHING(
+        alg.setPropertyValue("InputWorkspaces", "ws0,ws_inside"));
+    TS_ASSERT_THROWS_NOTHING(alg.setPropertyValue("OutputWorkspace", "ws0"));
+    TS_ASSERT_THROWS_NOTHING(alg.execute(););
+    TS_ASSERT(alg.isExecuted());
+
+    // The events were added to the boxes of the existing workspace
+    auto ws =
+        AnalysisDataService::Instance().retrieveWS<IMDEventWorkspace>("ws0");
+    TS_ASSERT_EQUALS(ws, ws0);
+    TS_ASSERT_EQUALS(ws->getNPoints(), 2 * 2 + 5 * 5);
+    TS_ASSERT_EQUALS(ws->getBoxController()->getTotalNumMDBoxes(), numBoxes);
+    for (size_t d = 0; d < 2; d++) {
+      IMDDimension_const_sptr dim = ws->getDimension(d);
+      TS_ASSERT_DELTA(dim->getMinimum(), 0.0, 1e-3);
+      TS_ASSERT_DELTA(dim->getMaximum(), 10.0, 1e-3);
+    }
+    TS_ASSERT_EQUALS(2, ws->getNumExperimentInfo());
+
+    AnalysisDataService::Instance().remove("ws_inside");
+  }
+
+  void test_append_beyond_extents_creates_new_workspace() {
+    auto ws0 =
+        AnalysisDataService::Instance().retrieveWS<IMDEventWorkspace>("ws0");
+
+    MergeMD alg;
+    TS_ASSERT_THROWS_NOTHING(alg.initialize())
+    TS_ASSERT_THROWS_NOTHING(
+        alg.setPropertyValue("InputWorkspaces", "ws0,ws2"));
+    TS_ASSERT_THROWS_NOTHING(alg.setPropertyValue("OutputWorkspace", "ws0"));
+    TS_ASSERT_THROWS_NOTHING(alg.execute(););
+    TS_ASSERT(alg.isExecuted());
+
+    auto ws =
+        AnalysisDataService::Instance().retrieveWS<IMDEventWorkspace>("ws0");
+    TS_ASSERT_DIFFERS(ws, ws0);
+    TS_ASSERT_EQUALS(ws->getNPoints(), 2 * 2 + 10 * 10);
+    TS_ASSERT_DELTA(ws->getDimension(0)->getMaximum(), 20.0, 1e-3);
+    TS_ASSERT_EQUALS(2, ws->getNumExperimentInfo());
+  }
+
+  void test_append_with_masked_boxes_creates_new_workspace() {
+    makeAnyMDEW<MDLeanEvent<2>, 2>(5, 0., 10., 1, "ws_inside");
+    // Mask half of the first workspace, which would keep its events in place
+    FrameworkManager::Instance().exec("MaskMD", 6, "Workspace", "ws0",
+                                      "Dimensions", "Axis0,Axis1", "Extents",
+                                      "0,5,0,10");
+    auto ws0 =
+        AnalysisDataService::Instance().retrieveWS<IMDEventWorkspace>("ws0");
+
+    MergeMD alg;
+    TS_ASSERT_THROWS_NOTHING(alg.initialize())
+    TS_ASSERT_THROWS_NOTHING(
+        alg.setPropertyValue("InputWorkspaces", "ws0,ws_inside"));
+    TS_ASSERT_THROWS_NOTHING(alg.setPropertyValue("OutputWorkspace", "ws0"));
+    TS_ASSERT_THROWS_NOTHING(alg.execute(););
+    TS_ASSERT(alg.isExecuted());
+
+    // The masked events of ws0 are left out, as when merging into a new name
+    auto ws =
+        AnalysisDataService::Instance().retrieveWS<IMDEventWorkspace>("ws0");
+    TS_ASSERT_DIFFERS(ws, ws0);
+    TS_ASSERT_EQUALS(ws->getNPoints(), 2 * 2 - 2 + 5 * 5);
+    std::vector<API::IMDNode *> boxes;
+    ws->getBoxes(boxes, 1000, true);
+    for (const auto box : boxes)
+      TS_ASSERT(!box->getIsMasked());
+    TS_ASSERT_EQUALS(2, ws->getNumExperimentInfo());
+
+    AnalysisDataService::Instance().remove("ws_inside");
+  }
+
+  void test_append_in_place_to_file_backed_workspace() {
+    makeAnyMDEW<MDLeanEvent<2>, 2>(5, 0., 10., 1, "ws_inside");
+    auto ws0 =
+        AnalysisDataService::Instance().retrieveWS<IMDEventWorkspace>("ws0");
+    SaveMD2 saver;
+    saver.initialize();
+    saver.setProperty("InputWorkspace", ws0);
+    saver.setPropertyValue("Filename", "MergeMDTestFileBack.nxs");
+    const std::string filename = saver.getPropertyValue("Filename");
+    if (Poco::File(filename).exists())
+      Poco::File(filename).remove();
+    TS_ASSERT_THROWS_NOTHING(saver.execute());
+
+    LoadMD loader;
+    loader.initialize();
+    loader.setPropertyValue("Filename", filename);
+    loader.setProperty("FileBackEnd", true);
+    loader.setPropertyValue("OutputWorkspace", "ws_file");
+    TS_ASSERT_THROWS_NOTHING(loader.execute());
+    auto fileBacked =
+        AnalysisDataService::Instance().retrieveWS<IMDEventWorkspace>(
+            "ws_file");
+    TS_ASSERT(fileBacked->isFileBacked());
+
+    MergeMD alg;
+    TS_ASSERT_THROWS_NOTHING(alg.initialize())
+    TS_ASSERT_THROWS_NOTHING(
+        alg.setPropertyValue("InputWorkspaces", "ws_file,ws_inside"));
+    TS_ASSERT_THROWS_NOTHING(
+        alg.setPropertyValue("OutputWorkspace", "ws_file"));
+    TS_ASSERT_THROWS_NOTHING(alg.execute(););
+    TS_ASSERT(alg.isExecuted());
+
+    auto ws = AnalysisDataService::Instance().retrieveWS<IMDEventWorkspace>(
+        "ws_file");
+    TS_ASSERT_EQUALS(ws, fileBacked);
+    TS_ASSERT(ws->isFileBacked());
+    TS_ASSERT_EQUALS(ws->getNPoints(), 2 * 2 + 5 * 5);
+
+    // The appended events were written to the file by SaveMD
+    LoadMD reloader;
+    reloader.initialize();
+    reloader.setPropertyValue("Filename", filename);
+    reloader.setProperty("FileBackEnd", false);
+    reloader.setPropertyValue("OutputWorkspace", "ws_reloaded");
+    TS_ASSERT_THROWS_NOTHING(reloader.execute());
+    auto reloaded =
+        AnalysisDataService::Instance().retrieveWS<IMDEventWorkspace>(
+            "ws_reloaded");
+    TS_ASSERT_EQUALS(reloaded->getNPoints(), 2 * 2 + 5 * 5);
+
+    ws->clearFileBacked(false);
+    AnalysisDataService::Instance().remove("ws_file");
+    AnalysisDataService::Instance().remove("ws_reloaded");
+    AnalysisDataService::Instance().remove("ws_inside");
+    if (Poco::File(filename).exists())
+      Poco::File(filename).remove();
+  }
+
   void test_masked_data_omitted() {
     // Name of the output workspace.
     std::string outWSName("MergeMDTest_OutputWS");
@@ -231,4 +373,46 @@ public:
     // Remove workspace from the data service.
     AnalysisDataService::Instance().remove(outWSName);
   }
+
+  void test_runIndex_in_place() {
+    makeAnyMDEW<MDEvent<3>, 3>(2, 5., 10., 1, "mde3_second");
+    makeAnyMDEW<MDEvent<3>, 3>(2, 5., 10., 1, "mde3_third");
+
+    MergeMD alg;
+    TS_ASSERT_THROWS_NOTHING(alg.initialize())
+    TS_ASSERT_THROWS_NOTHING(alg.setPropertyValue(
+        "InputWorkspaces", "mde3,mde3_second,mde3_third"));
+    TS_ASSERT_THROWS_NOTHING(alg.setPropertyValue("OutputWorkspace", "mde3"));
+    TS_ASSERT_THROWS_NOTHING(alg.execute(););
+    TS_ASSERT(alg.isExecuted());
+
+    MDEventWorkspace3::sptr ws;
+    TS_ASSERT_THROWS_NOTHING(
+        ws = AnalysisDataService::Instance().retrieveWS<MDEventWorkspace3>(
+            "mde3");)
+    TS_ASSERT(ws);
+    TS_ASSERT_EQUALS(3, ws->getNumExperimentInfo());
+
+    std::vector<API::IMDNode *> boxes;
+    ws->getBox()->getBoxes(boxes, 10, true);
+    API::IMDNode *box = boxes[0];
+    TS_ASSERT_EQUALS(box->getNPoints(), 3);
+    std::vector<coord_t> events;
+    size_t ncols;
+    box->getEventsData(events, ncols);
+    TS_ASSERT_EQUALS(ncols, 7);
+    TS_ASSERT_EQUALS(events.size(), 21);
+
+    // The events already in place keep run index 0, the appended ones follow
+    // the experiment infos of their workspaces
+    const std::vector<coord_t> ref = {1, 1, 0, 0, 6.25, 6.25, 6.25,
+                                      1, 1, 1, 0, 6.25, 6.25, 6.25,
+                                      1, 1, 2, 0, 6.25, 6.25, 6.25};
+    for (auto i = 0; i < 21; i++) {
+      TS_ASSERT_EQUALS(events[i], ref[i]);
+    }
+
+    AnalysisDataService::Instance().remove("mde3_second");
+    AnalysisDataService::Instance().remove("mde3_third");
+  }
 };
@@ -77,10 +77,17 @@ public:
   int writeNexusProcessedDataEvent(
       const DataObjects::EventWorkspace_const_sptr &ws);
 
-  int writeNexusProcessedDataEventCombined(
+  int makeNexusProcessedDataEventFields(
       const DataObjects::EventWorkspace_const_sptr &ws,
-      std::vector<int64_t> &indices, double *tofs, float *weights,
-      float *errorSquareds, int64_t *pulsetimes, bool compress) const;
+      std::vector<int64_t> &indices, const int64_t chunkSize,
+      const int compressionLevel, const bool writePulsetime,
+      const bool writeWeights) const;
+
+  int writeNexusProcessedDataEventBlock(const int64_t start,
+                                        const int64_t count, const double *tofs,
+                                        const float *weights,
+                                        const float *errorSquareds,
+                                        const int64_t *pulsetimes) const;
 
   int writeEventList(const DataObjects::EventList &el,
                      const std::string &group_name) const;
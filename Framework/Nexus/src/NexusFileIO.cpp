@@ -6,6 +6,7 @@
 // SPDX - License - Identifier: GPL - 3.0 +
 // NexusFileIO
 // @author Ronald Fowler
+#include <algorithm>
 #include <sstream>
 #include <vector>
 
@@ -735,21 +736,27 @@ int NexusFileIO::writeNexusTableWorkspace(
 }
 
 //-------------------------------------------------------------------------------------
-/** Write out a combined chunk of event data
+/** Write out the index of the first event of each spectrum and create the
+ * fields holding every event, to be filled in block by block by
+ * writeNexusProcessedDataEventBlock. The fields are chunked, so that each
+ * block is compressed on its own as it is written.
  *
  * @param ws :: an EventWorkspace
- * @param indices :: array of event list indexes
- * @param tofs :: array of TOFs
- * @param weights :: array of event weights
- * @param errorSquareds :: array of event squared errors
- * @param pulsetimes :: array of pulsetimes
- * @param compress :: if true, compress the entry
+ * @param indices :: index of the first event of each spectrum, followed by
+ * the total number of events
+ * @param chunkSize :: number of events in each chunk of the fields
+ * @param compressionLevel :: deflate level from 1 to 9, or 0 not to compress
+ * @param writePulsetime :: if true, create the pulsetime field
+ * @param writeWeights :: if true, create the weight and error_squared fields
  */
-int NexusFileIO::writeNexusProcessedDataEventCombined(
+int NexusFileIO::makeNexusProcessedDataEventFields(
     const DataObjects::EventWorkspace_const_sptr &ws,
-    std::vector<int64_t> &indices, double *tofs, float *weights,
-    float *errorSquareds, int64_t *pulsetimes, bool compress) const {
+    std::vector<int64_t> &indices, const int64_t chunkSize,
+    const int compressionLevel, const bool writePulsetime,
+    const bool writeWeights) const {
   NXopengroup(fileID, "event_workspace", "NXdata");
+  const bool compress =
+      compressionLevel > 0 && m_nexuscompression != NX_COMP_NONE;
 
   // The array of indices for each event list #
   int dims_array[1] = {static_cast<int>(indices.size())};
@@ -770,20 +777,61 @@ int NexusFileIO::writeNexusProcessedDataEventCombined(
     NXclosedata(fileID);
   }
 
-  // Write out each field
-  dims_array[0] = static_cast<int>(
-      indices.back()); // TODO big truncation error! This is the # of events
-  if (tofs)
-    NXwritedata("tof", NX_FLOAT64, 1, dims_array, tofs, compress);
-  if (pulsetimes)
-    NXwritedata("pulsetime", NX_INT64, 1, dims_array, pulsetimes, compress);
-  if (weights)
-    NXwritedata("weight", NX_FLOAT32, 1, dims_array, weights, compress);
-  if (errorSquareds)
-    NXwritedata("error_squared", NX_FLOAT32, 1, dims_array, errorSquareds,
-                compress);
+  // Create each field, with 64 bit dimensions as there may be more than 2^31
+  // events
+  int64_t dims[1] = {indices.empty() ? 0 : indices.back()};
+  int64_t chunk[1] = {std::max<int64_t>(std::min(chunkSize, dims[0]), 1)};
+  const auto makeField = [&](const char *name, const int datatype) {
+    // A chunk cannot be larger than an empty field
+    if (compress && dims[0] > 0)
+      NXcompmakedata64(fileID, name, datatype, 1, dims,
+                       NX_COMP_LZW_LVL0 + compressionLevel, chunk);
+    else
+      NXmakedata64(fileID, name, datatype, 1, dims);
+  };
+  makeField("tof", NX_FLOAT64);
+  if (writePulsetime)
+    makeField("pulsetime", NX_INT64);
+  if (writeWeights) {
+    makeField("weight", NX_FLOAT32);
+    makeField("error_squared", NX_FLOAT32);
+  }
+
+  NXstatus status = NXclosegroup(fileID);
+  return ((status == NX_ERROR) ? 3 : 0);
+}
+
+//-------------------------------------------------------------------------------------
+/** Write out a block of consecutive events into the fields created by
+ * makeNexusProcessedDataEventFields.
+ *
+ * @param start :: index of the first event of the block
+ * @param count :: number of events in the block
+ * @param tofs :: array of TOFs
+ * @param weights :: array of event weights, or null if not written
+ * @param errorSquareds :: array of event squared errors, or null if not
+ * written
+ * @param pulsetimes :: array of pulsetimes, or null if not written
+ */
+int NexusFileIO::writeNexusProcessedDataEventBlock(
+    const int64_t start, const int64_t count, const double *tofs,
+    const float *weights, const float *errorSquareds,
+    const int64_t *pulsetimes) const {
+  NXopengroup(fileID, "event_workspace", "NXdata");
+  const int64_t slabStart[1] = {start};
+  const int64_t slabSize[1] = {count};
+  const auto writeField = [&](const char *name, const void *data) {
+    if (!data || count == 0)
+      return;
+    NXopendata(fileID, name);
+    NXputslab64(fileID, data, slabStart, slabSize);
+    NXclosedata(fileID);
+  };
+  writeField("tof", tofs);
+  writeField("pulsetime", pulsetimes);
+  writeField("weight", weights);
+  writeField("error_squared", errorSquareds);
 
-  // Close up the overall group
   NXstatus status = NXclosegroup(fileID);
   return ((status == NX_ERROR) ? 3 : 0);
 }
@@ -20,7 +20,15 @@ GET_POINTER_SPECIALIZATION(EventWorkspace)
 
 void export_EventWorkspace() {
   class_<EventWorkspace, bases<IEventWorkspace>, boost::noncopyable>(
-      "EventWorkspace", no_init);
+      "EventWorkspace", no_init)
+      .def("getMRUHits", &EventWorkspace::MRUHits, args("self"),
+           "Returns the number of histogram lookups that were served from the "
+           "most-recently-used lists")
+      .def("getMRUMisses", &EventWorkspace::MRUMisses, args("self"),
+           "Returns the number of histogram lookups that had to be generated "
+           "from the events")
+      .def("resetMRUCounters", &EventWorkspace::resetMRUCounters, args("self"),
+           "Reset the most-recently-used list hit and miss counters to zero");
 
   // register pointers
   RegisterWorkspacePtrToPython<EventWorkspace>();
@@ -39,6 +39,17 @@ class IEventWorkspaceTest(unittest.TestCase):
             error_raised = True
         self.assertFalse(error_raised)
 
+    def test_MRU_hits_and_misses_are_counted(self):
+        self._test_ws.clearMRU()
+        self._test_ws.resetMRUCounters()
+        self._test_ws.readY(0)
+        self.assertEqual(self._test_ws.getMRUMisses(), 1)
+        self._test_ws.readY(0)
+        self.assertEqual(self._test_ws.getMRUHits(), 1)
+        self._test_ws.resetMRUCounters()
+        self.assertEqual(self._test_ws.getMRUHits(), 0)
+        self.assertEqual(self._test_ws.getMRUMisses(), 0)
+
     def test_event_list_is_return_as_correct_type(self):
         el = self._test_ws.getSpectrum(0)
         self.assertTrue(isinstance(el, IEventList))